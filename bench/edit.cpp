@@ -0,0 +1,109 @@
+/**
+ * @file edit.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the bit-parallel edit distance over the header order
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <chrono>
+#include <finger/distance.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <test/bench.hpp>
+#include <test/dataset.hpp>
+
+/**
+ * @brief Shortest total time of the runs of a measure
+ */
+static constexpr std::chrono::milliseconds RUN_TIME(500);
+
+/**
+ * @brief Hashed header orders of the dataset fingerprints, with some headers swapped or dropped
+ */
+static std::vector<std::vector<std::uint32_t>> load_orders(std::size_t count) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::vector<std::uint32_t>> base;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "fingerprint" })) {
+            Fingerprint fp(entry["fingerprint"].get<std::string>(), FULL_FEATURES);
+            base.emplace_back(fp.headerOrder().begin(), fp.headerOrder().end());
+        }
+    }
+
+    std::mt19937 rng(42); // NOLINT(readability-magic-numbers)
+    std::vector<std::vector<std::uint32_t>> orders;
+
+    for (std::size_t i = 0; i < count; i++) {
+        std::vector<std::uint32_t> order = base[i % base.size()];
+
+        if (order.size() > 2) {
+            std::uniform_int_distribution<std::size_t> position(0, order.size() - 2);
+
+            std::swap(order[position(rng)], order[position(rng)]);
+            order.erase(order.begin() + static_cast<std::ptrdiff_t>(position(rng)));
+        }
+
+        orders.push_back(std::move(order));
+    }
+
+    return orders;
+}
+
+/**
+ * @brief Edit distance with the whole dynamic programming matrix, as a reference
+ */
+static std::size_t matrix_distance(const std::vector<std::uint32_t>& a,
+                                   const std::vector<std::uint32_t>& b) {
+    std::vector<std::size_t> d((a.size() + 1) * (b.size() + 1));
+    std::size_t w = b.size() + 1;
+
+    for (std::size_t i = 0; i <= a.size(); i++) {
+        for (std::size_t j = 0; j <= b.size(); j++) {
+            if (i == 0 || j == 0) {
+                d[i * w + j] = i + j;
+            } else {
+                std::size_t substitution = d[(i - 1) * w + j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1);
+                d[i * w + j] =
+                std::min({ d[(i - 1) * w + j] + 1, d[i * w + j - 1] + 1, substitution });
+            }
+        }
+    }
+
+    return d.back();
+}
+
+int main() {
+    static constexpr std::size_t ORDERS = 4096;
+
+    std::vector<std::vector<std::uint32_t>> orders = load_orders(ORDERS);
+    const std::vector<std::uint32_t>& query = orders.front();
+    volatile std::size_t sink = 0;
+
+    std::cout << std::setw(20) << "method" << std::setw(22) << "comparisons/s/core" << std::endl;
+
+    auto report = [&](const char* name, auto&& compare) {
+        double ns = measure_average(
+        [&]() {
+            std::size_t total = 0;
+
+            for (const auto& order: orders) {
+                total += compare(order);
+            }
+
+            sink = total;
+        },
+        RUN_TIME);
+
+        std::cout << std::setw(20) << name << std::setw(22) << std::fixed << std::setprecision(0)
+                  << ORDERS / ns * 1e9 << std::endl;
+    };
+
+    report("matrix", [&](const auto& order) { return matrix_distance(query, order); });
+    report("bit-parallel", [&](const auto& order) { return editDistance(query, order); });
+    report("bit-parallel, max 2", [&](const auto& order) { return editDistance(query, order, 2); });
+
+    return 0;
+}
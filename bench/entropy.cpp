@@ -0,0 +1,79 @@
+/**
+ * @file entropy.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the sampled entropy estimation against the exact computation
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <chrono>
+#include <filesystem>
+#include <finger/fingerprint.hpp>
+#include <finger/payload.hpp>
+#include <iomanip>
+#include <iostream>
+#include <test/bench.hpp>
+#include <test/dataset.hpp>
+
+/**
+ * @brief Shortest total time of the runs of a measure
+ */
+static constexpr std::chrono::milliseconds RUN_TIME(200);
+
+/**
+ * @brief Concatenates the payloads of the bundled datasets
+ */
+static std::string load_payloads(const std::string& directory) {
+    std::string payloads;
+
+    for (const auto& file: std::filesystem::directory_iterator(directory)) {
+        for (auto& entry: dataset_use(file.path().string())) {
+            payloads += entry["request"]["payload"].get<std::string>();
+        }
+    }
+
+    return payloads;
+}
+
+int main() {
+    std::string payloads = load_payloads("datasets");
+    EntropySampling sampling;
+    volatile float sink = 0;
+
+    std::cout << "Payload bytes in datasets: " << payloads.size() << std::endl;
+    std::cout << std::setw(10) << "size" << std::setw(14) << "exact (MB/s)" << std::setw(16)
+              << "sampled (MB/s)" << std::setw(10) << "exact" << std::setw(10) << "sampled"
+              << std::endl;
+
+    for (std::size_t size: { 1U << 20U, 8U << 20U, 64U << 20U }) {
+        // Body built by repeating the dataset payloads
+        std::string body;
+
+        while (body.size() < size) {
+            body += payloads;
+        }
+
+        body.resize(size);
+
+        ByteHistogram counts {};
+        byteOccurrences(body, counts);
+        float exact = histogramEntropy(counts, body.size());
+        float sampled = sampledEntropy(body, sampling);
+
+        double exact_ns = measure_average(
+        [&]() {
+            ByteHistogram c {};
+            byteOccurrences(body, c);
+            sink = histogramEntropy(c, body.size());
+        },
+        RUN_TIME);
+        double sampled_ns =
+        measure_average([&]() { sink = sampledEntropy(body, sampling); }, RUN_TIME);
+
+        std::cout << std::setw(10) << size << std::setw(14) << std::fixed << std::setprecision(0)
+                  << size / exact_ns * 1e3 << std::setw(16) << size / sampled_ns * 1e3
+                  << std::setw(10) << std::setprecision(1) << exact << std::setw(10) << sampled
+                  << std::endl;
+    }
+
+    return 0;
+}
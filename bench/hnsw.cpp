@@ -0,0 +1,147 @@
+/**
+ * @file hnsw.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the recall and latency of the HNSW graph against a brute force scan
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <filesystem>
+#include <finger/fingerprint.hpp>
+#include <finger/hnsw.hpp>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <test/bench.hpp>
+#include <test/dataset.hpp>
+#include <thread>
+
+/**
+ * @brief Number of reference fingerprints
+ */
+static constexpr std::size_t ROWS = 100000;
+
+/**
+ * @brief Number of queries
+ */
+static constexpr std::size_t QUERIES = 500;
+
+/**
+ * @brief Number of neighbours searched
+ */
+static constexpr std::size_t K = 10;
+
+/**
+ * @brief Fingerprints of the requests of the bundled datasets
+ */
+static std::vector<std::string> load_fingerprints(const std::string& directory) {
+    std::vector<std::string> fingerprints;
+
+    for (const auto& file: std::filesystem::directory_iterator(directory)) {
+        for (auto& entry: dataset_use(file.path().string())) {
+            auto parsed = entry["request"]["parsed"].get<std::vector<std::string>>();
+            std::istringstream line(parsed[0]);
+            std::string method;
+            std::string uri;
+            std::string version;
+
+            line >> method >> uri >> version;
+
+            if (version.rfind("HTTP/", 0) == 0) {
+                version = version.substr(5); // NOLINT(readability-magic-numbers)
+            }
+
+            HTTPRequest req(uri, method, version, { parsed.begin() + 1, parsed.end() },
+                            entry["request"]["payload"].get<std::string>());
+            fingerprints.push_back(fingerprint(req));
+        }
+    }
+
+    return fingerprints;
+}
+
+/**
+ * @brief Builds the graph, adding the references from several threads
+ */
+static void build(HNSWIndex& index, const std::vector<std::string>& references,
+                  std::size_t threads) {
+    std::vector<std::thread> workers;
+
+    for (std::size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            for (std::size_t i = t; i < references.size(); i += threads) {
+                index.add(references[i]);
+            }
+        });
+    }
+
+    for (std::thread& worker: workers) {
+        worker.join();
+    }
+}
+
+int main() {
+    std::vector<std::string> base = load_fingerprints("datasets");
+    std::vector<std::string> references = dataset_perturb(base, ROWS, 42, true); // NOLINT
+    std::vector<Fingerprint> queries;
+    std::size_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+    for (const std::string& fp: dataset_perturb(base, QUERIES, 7, true)) { // NOLINT
+        queries.emplace_back(fp, FULL_FEATURES);
+    }
+
+    std::cout << "Dataset fingerprints: " << base.size() << ", rows: " << ROWS
+              << ", queries: " << QUERIES << ", k: " << K << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    // Brute force: the exact neighbours, and the time to find them
+    FingerprintTable table(FULL_FEATURES);
+    std::vector<double> kth(QUERIES);
+    std::vector<double> all(ROWS);
+
+    table.reserve(ROWS);
+
+    for (const std::string& fp: references) {
+        table.add(Fingerprint(fp, FULL_FEATURES));
+    }
+
+    double scan_ms = measure([&]() {
+        for (std::size_t q = 0; q < QUERIES; q++) {
+            table.distances(queries[q], all);
+            std::nth_element(all.begin(), all.begin() + K - 1, all.end());
+            kth[q] = all[K - 1];
+        }
+    });
+
+    HNSWParams params;
+    HNSWIndex index(FULL_FEATURES, ROWS, params);
+    double build_ms = measure([&]() { build(index, references, threads); });
+
+    std::cout << "Build (m " << params.m << ", ef_construction " << params.ef_construction
+              << "): " << build_ms << " ms on " << threads << " threads" << std::endl;
+
+    std::cout << std::setw(14) << "search" << std::setw(12) << "recall" << std::setw(14)
+              << "us/query" << std::setw(16) << "queries/s" << std::endl;
+    std::cout << std::setw(14) << "brute force" << std::setw(12) << 1.0 << std::setw(14)
+              << scan_ms * 1e3 / QUERIES << std::setw(16) << QUERIES / scan_ms * 1e3
+              << std::endl;
+
+    for (std::size_t ef: { 10, 20, 50, 100, 200 }) {
+        std::size_t found = 0;
+        double ms = measure([&]() {
+            for (std::size_t q = 0; q < QUERIES; q++) {
+                for (const TableMatch& match: index.knn(queries[q], K, ef)) {
+                    found += match.distance <= kth[q] + 1e-6 ? 1 : 0; // NOLINT
+                }
+            }
+        });
+        double batch_ms = measure([&]() { index.knn(queries, K, ef, threads); });
+
+        std::cout << std::setw(14) << ("ef " + std::to_string(ef)) << std::setw(12)
+                  << std::setprecision(3) << static_cast<double>(found) / (QUERIES * K)
+                  << std::setprecision(1) << std::setw(14) << ms * 1e3 / QUERIES << std::setw(16)
+                  << QUERIES / batch_ms * 1e3 << std::endl;
+    }
+
+    return 0;
+}
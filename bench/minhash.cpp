@@ -0,0 +1,127 @@
+/**
+ * @file minhash.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the LSH index of MinHash signatures against a scan, as the references grow
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <array>
+#include <finger/minhash.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <test/bench.hpp>
+#include <test/dataset.hpp>
+
+/**
+ * @brief Numbers of reference signatures
+ */
+static constexpr std::array<std::size_t, 3> ROWS = { 10000, 40000, 160000 };
+
+/**
+ * @brief Number of queries, references with a header dropped
+ */
+static constexpr std::size_t QUERIES = 500;
+
+/**
+ * @brief Lowest Jaccard similarity searched
+ */
+static constexpr double THRESHOLD = 0.7;
+
+/**
+ * @brief Header sets drawn from the header lines seen in the dataset, as many client stacks
+ * would give
+ */
+static std::vector<std::vector<std::string>> build_headers(std::size_t rows) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::string> lines;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "headers" })) {
+            for (const std::string& line: entry["headers"].get<std::vector<std::string>>()) {
+                lines.push_back(line);
+            }
+        }
+    }
+
+    std::sort(lines.begin(), lines.end());
+    lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+
+    std::mt19937 rng(42); // NOLINT(readability-magic-numbers)
+    std::vector<std::vector<std::string>> requests;
+    requests.reserve(rows);
+
+    for (std::size_t i = 0; i < rows; i++) {
+        std::shuffle(lines.begin(), lines.end(), rng);
+        requests.emplace_back(lines.begin(), lines.begin() + 6 + rng() % 10); // NOLINT
+    }
+
+    return requests;
+}
+
+int main() {
+    std::vector<std::vector<std::string>> requests = build_headers(ROWS.back());
+    std::vector<std::vector<std::uint32_t>> signatures;
+    std::vector<std::vector<std::uint32_t>> queries;
+    MinHashIndex shape(THRESHOLD);
+
+    for (const std::vector<std::string>& headers: requests) {
+        signatures.push_back(minhash(header_tokens(headers), shape.hashes()));
+    }
+
+    // References with their second header dropped
+    for (std::size_t q = 0; q < QUERIES; q++) {
+        std::vector<std::string> headers = requests[q * (ROWS.front() / QUERIES)];
+
+        headers.erase(headers.begin() + 1);
+        queries.push_back(minhash(header_tokens(headers), shape.hashes()));
+    }
+
+    std::cout << "Threshold: " << THRESHOLD << ", bands: " << shape.bands()
+              << ", rows: " << shape.rows() << ", queries: " << QUERIES << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(12) << "build ms" << std::setw(14)
+              << "index us/q" << std::setw(14) << "scan us/q" << std::setw(12) << "speedup"
+              << std::setw(14) << "candid./q" << std::setw(10) << "recall" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    for (std::size_t rows: ROWS) {
+        MinHashIndex index(THRESHOLD);
+        std::size_t candidates = 0;
+        std::size_t found = 0;
+        std::size_t scanned = 0;
+
+        double build_ms = measure([&]() {
+            for (std::size_t r = 0; r < rows; r++) {
+                index.add(signatures[r]);
+            }
+        });
+        double index_ms = measure([&]() {
+            for (const std::vector<std::uint32_t>& query: queries) {
+                found += index.similar(query).size();
+            }
+        });
+
+        for (const std::vector<std::uint32_t>& query: queries) {
+            candidates += index.candidates(query).size();
+        }
+
+        double scan_ms = measure([&]() {
+            for (const std::vector<std::uint32_t>& query: queries) {
+                for (std::size_t r = 0; r < rows; r++) {
+                    scanned += minhashSimilarity(signatures[r], query) >= THRESHOLD ? 1 : 0;
+                }
+            }
+        });
+
+        std::cout << std::setw(8) << rows << std::setw(12) << build_ms << std::setw(14)
+                  << index_ms * 1e3 / QUERIES << std::setw(14) << scan_ms * 1e3 / QUERIES
+                  << std::setw(12) << scan_ms / index_ms << std::setw(14)
+                  << static_cast<double>(candidates) / QUERIES << std::setw(10)
+                  << std::setprecision(3)
+                  << static_cast<double>(found) / static_cast<double>(scanned)
+                  << std::setprecision(1) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file simhash.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the multi-index Hamming search of SimHash signatures against a scan
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <bit>
+#include <finger/simhash.hpp>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <test/bench.hpp>
+#include <test/dataset.hpp>
+
+/**
+ * @brief Number of reference signatures
+ */
+static constexpr std::size_t ROWS = 1000000;
+
+/**
+ * @brief Number of queries, references with a header dropped
+ */
+static constexpr std::size_t QUERIES = 1000;
+
+/**
+ * @brief Fingerprints built from the dataset ones, with a random header order drawn from the
+ * headers seen in the dataset, as many client stacks would give
+ */
+static std::vector<std::string> build_fingerprints(std::size_t rows) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::vector<std::string>> base;
+    std::vector<std::string> headers;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "fingerprint" })) {
+            std::vector<std::string> fields(1);
+
+            for (char c: entry["fingerprint"].get<std::string>()) {
+                if (c == '|') {
+                    fields.emplace_back();
+                } else {
+                    fields.back() += c;
+                }
+            }
+
+            std::string order = fields[FEATURE_HEADER_ORDER] + ",";
+
+            for (std::size_t start = 0, end; (end = order.find(',', start)) != std::string::npos;
+                 start = end + 1) {
+                headers.push_back(order.substr(start, end - start));
+            }
+
+            base.push_back(std::move(fields));
+        }
+    }
+
+    std::sort(headers.begin(), headers.end());
+    headers.erase(std::unique(headers.begin(), headers.end()), headers.end());
+
+    std::mt19937 rng(42); // NOLINT(readability-magic-numbers)
+    std::vector<std::string> fingerprints;
+    fingerprints.reserve(rows);
+
+    for (std::size_t i = 0; i < rows; i++) {
+        std::vector<std::string> fields = base[rng() % base.size()];
+        std::shuffle(headers.begin(), headers.end(), rng);
+
+        std::string& order = fields[FEATURE_HEADER_ORDER];
+        order = headers[0];
+
+        for (std::size_t h = 1; h < 6 + rng() % 10; h++) { // NOLINT(readability-magic-numbers)
+            order += "," + headers[h];
+        }
+
+        std::string fp = fields[0];
+
+        for (std::size_t f = 1; f < fields.size(); f++) {
+            fp += "|" + fields[f];
+        }
+
+        fingerprints.push_back(std::move(fp));
+    }
+
+    return fingerprints;
+}
+
+int main() {
+    std::vector<std::string> fingerprints = build_fingerprints(ROWS);
+    std::vector<std::uint64_t> signatures;
+    std::vector<std::uint64_t> queries;
+
+    for (const std::string& fp: fingerprints) {
+        signatures.push_back(simhash(fp, FULL_FEATURES));
+    }
+
+    // References with their second header dropped
+    for (std::size_t q = 0; q < QUERIES; q++) {
+        std::string fp = fingerprints[q * (ROWS / QUERIES)];
+        std::size_t comma = fp.find(',');
+
+        fp.erase(comma, fp.find_first_of(",|", comma + 1) - comma);
+        queries.push_back(simhash(fp, FULL_FEATURES));
+    }
+
+    std::cout << "Rows: " << ROWS << ", queries: " << QUERIES << std::endl;
+    std::cout << std::setw(6) << "k" << std::setw(12) << "build ms" << std::setw(14)
+              << "index us/q" << std::setw(14) << "scan us/q" << std::setw(12) << "speedup"
+              << std::setw(14) << "matches/q" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    for (int k: { 3, 6, 10 }) {
+        std::size_t found = 0;
+        std::size_t scanned = 0;
+        std::unique_ptr<SimHashIndex> index;
+
+        double build_ms =
+        measure([&]() { index = std::make_unique<SimHashIndex>(signatures, k); });
+        double index_ms = measure([&]() {
+            for (std::uint64_t query: queries) {
+                found += index->within(query).size();
+            }
+        });
+        double scan_ms = measure([&]() {
+            for (std::uint64_t query: queries) {
+                for (std::uint64_t signature: signatures) {
+                    scanned += std::popcount(signature ^ query) <= k ? 1 : 0;
+                }
+            }
+        });
+
+        if (found != scanned) {
+            std::cerr << "Index and scan disagree" << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(6) << k << std::setw(12) << build_ms << std::setw(14)
+                  << index_ms * 1e3 / QUERIES << std::setw(14) << scan_ms * 1e3 / QUERIES
+                  << std::setw(12) << scan_ms / index_ms << std::setw(14)
+                  << static_cast<double>(found) / QUERIES << std::endl;
+    }
+
+    return 0;
+}
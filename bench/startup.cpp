@@ -0,0 +1,86 @@
+/**
+ * @file startup.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the load time and memory cost of the library
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The library is loaded with dlopen, the benchmark is not linked against it so that every load
+ * runs its initialization. A library defining inline variables cannot be unloaded, each load is
+ * made from a fresh copy of the file.
+ */
+#include <chrono>
+#include <dlfcn.h>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <malloc.h>
+#include <string>
+#include <unistd.h>
+
+/**
+ * @brief Number of loads measured
+ */
+static constexpr int LOADS = 50;
+
+/**
+ * @brief Resident memory of the process, in KiB
+ */
+static long resident_kib() {
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+
+    statm >> size >> resident;
+
+    return resident * (sysconf(_SC_PAGESIZE) / 1024); // NOLINT(readability-magic-numbers)
+}
+
+int main(int argc, char** argv) {
+    using clock = std::chrono::steady_clock;
+
+    std::filesystem::path library = argc > 1 ? argv[1] : "out/fingerlib.so";
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "fingerlib-startup";
+
+    std::filesystem::create_directories(directory);
+
+    std::chrono::nanoseconds elapsed {};
+    long resident = 0;
+    long heap = 0;
+
+    for (int i = 0; i < LOADS; i++) {
+        std::filesystem::path copy = directory / ("fingerlib-" + std::to_string(i) + ".so");
+        std::filesystem::copy_file(
+        library, copy, std::filesystem::copy_options::overwrite_existing);
+
+        long resident_before = resident_kib();
+        long heap_before = static_cast<long>(mallinfo2().uordblks);
+        auto begin = clock::now();
+
+        void* handle = dlopen(copy.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+        elapsed += clock::now() - begin;
+
+        if (handle == nullptr) {
+            std::cerr << dlerror() << std::endl;
+            return 1;
+        }
+
+        resident += resident_kib() - resident_before;
+        heap += static_cast<long>(mallinfo2().uordblks) - heap_before;
+    }
+
+    std::filesystem::remove_all(directory);
+
+    std::cout << library.string() << " (average of " << LOADS << " loads)" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  load time:       "
+              << std::chrono::duration<double, std::micro>(elapsed).count() / LOADS << " us"
+              << std::endl;
+    std::cout << "  resident memory: " << static_cast<double>(resident) / LOADS << " KiB"
+              << std::endl;
+    std::cout << "  heap:            " << static_cast<double>(heap) / LOADS << " B" << std::endl;
+
+    return 0;
+}
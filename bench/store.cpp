@@ -0,0 +1,62 @@
+/**
+ * @file store.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the one-vs-many comparison of a query against a fingerprint table
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <chrono>
+#include <finger/store.hpp>
+#include <iomanip>
+#include <iostream>
+#include <test/bench.hpp>
+#include <test/dataset.hpp>
+
+/**
+ * @brief Number of reference fingerprints
+ */
+static constexpr std::size_t ROWS = 1000000;
+
+/**
+ * @brief Shortest total time of the runs of a measure
+ */
+static constexpr std::chrono::seconds RUN_TIME(1);
+
+int main() {
+    std::vector<std::string> references =
+    dataset_perturb(dataset_fingerprints(), ROWS, 42, false); // NOLINT(readability-magic-numbers)
+
+    std::cout << "Kernel: " << distance_kernel() << ", rows: " << ROWS << std::endl;
+    std::cout << std::setw(16) << "mode" << std::setw(12) << "threshold" << std::setw(16)
+              << "Mrows/s/core" << std::setw(10) << "matches" << std::endl;
+
+    for (auto [name, mode]: { std::pair { "FULL_FEATURES", FULL_FEATURES },
+                              std::pair { "FEATURESET[2]", FEATURESET[2] } }) {
+        FingerprintTable table(mode);
+        table.reserve(ROWS);
+
+        for (const std::string& fp: references) {
+            table.add(Fingerprint(fp, FULL_FEATURES));
+        }
+
+        Fingerprint query(references[ROWS / 2], FULL_FEATURES);
+        std::vector<double> out(table.size());
+
+        double all_ns = measure_average([&]() { table.distances(query, out); }, RUN_TIME);
+        std::cout << std::setw(16) << name << std::setw(12) << "all" << std::setw(16) << std::fixed
+                  << std::setprecision(1) << ROWS / all_ns * 1e3 << std::setw(10) << ROWS
+                  << std::endl;
+
+        for (double threshold: { 0.02, 0.1, 0.3 }) {
+            std::size_t matches = 0;
+            double ns = measure_average(
+            [&]() { matches = table.within(query, threshold).size(); }, RUN_TIME);
+
+            std::cout << std::setw(16) << name << std::setw(12) << std::setprecision(2)
+                      << threshold << std::setw(16) << std::setprecision(1) << ROWS / ns * 1e3
+                      << std::setw(10) << matches << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file vptree.cpp
+ * @author Gautier Miquet
+ * @brief Benchmark of the vantage-point tree against the scan of a fingerprint table
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <finger/vptree.hpp>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <test/bench.hpp>
+#include <test/dataset.hpp>
+#include <thread>
+
+/**
+ * @brief Number of reference fingerprints
+ */
+static constexpr std::size_t ROWS = 200000;
+
+/**
+ * @brief Number of queries, taken among the references
+ */
+static constexpr std::size_t QUERIES = 200;
+
+int main() {
+    std::vector<std::string> references =
+    dataset_perturb(dataset_fingerprints(), ROWS, 42, false); // NOLINT(readability-magic-numbers)
+    std::vector<Fingerprint> queries;
+
+    for (std::size_t q = 0; q < QUERIES; q++) {
+        queries.emplace_back(references[q * (ROWS / QUERIES)], FULL_FEATURES);
+    }
+
+    std::cout << "Rows: " << ROWS << ", queries: " << QUERIES << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    double serial_ms = measure([&]() { VPTree tree(references, FULL_FEATURES, 1); });
+    std::optional<VPTree> tree;
+    double parallel_ms = measure([&]() { tree.emplace(references, FULL_FEATURES); });
+
+    std::cout << "Build: " << serial_ms << " ms on 1 thread, " << parallel_ms << " ms on "
+              << std::thread::hardware_concurrency() << " threads" << std::endl;
+
+    FingerprintTable table(FULL_FEATURES);
+    table.reserve(ROWS);
+
+    for (const std::string& fp: references) {
+        table.add(Fingerprint(fp, FULL_FEATURES));
+    }
+
+    std::vector<double> out(table.size());
+    double scan_ms = measure([&]() {
+        for (const Fingerprint& query: queries) {
+            table.distances(query, out);
+        }
+    });
+
+    std::cout << std::setw(16) << "query" << std::setw(16) << "us/query" << std::setw(12)
+              << "speedup" << std::endl;
+    std::cout << std::setw(16) << "table scan" << std::setw(16) << scan_ms * 1e3 / QUERIES
+              << std::setw(12) << 1.0 << std::endl;
+
+    for (std::size_t k: { 1, 10 }) {
+        double ms = measure([&]() {
+            for (const Fingerprint& query: queries) {
+                tree->knn(query, k);
+            }
+        });
+
+        std::cout << std::setw(16) << ("knn " + std::to_string(k)) << std::setw(16)
+                  << ms * 1e3 / QUERIES << std::setw(12) << scan_ms / ms << std::endl;
+    }
+
+    for (double radius: { 0.02, 0.1 }) {
+        std::ostringstream name;
+        name << "within " << std::setprecision(2) << radius;
+        double ms = measure([&]() {
+            for (const Fingerprint& query: queries) {
+                tree->within(query, radius);
+            }
+        });
+
+        std::cout << std::setw(16) << name.str() << std::setw(16) << ms * 1e3 / QUERIES
+                  << std::setw(12) << scan_ms / ms << std::endl;
+    }
+
+    return 0;
+}
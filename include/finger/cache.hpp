@@ -0,0 +1,162 @@
+/**
+ * @file cache.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the bounded caches used to memoize encoded header values and blocks
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_CACHE_HPP
+#define FINGER_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Headers whose encoded value can be memoized
+ */
+enum class CachedHeader { UserAgent, Accept, AcceptLanguage, Count };
+
+/**
+ * @brief Hit and miss counters of a cache
+ */
+struct CacheStats {
+    std::uint64_t hits;
+    std::uint64_t misses;
+};
+
+/**
+ * @brief Bounded, direct-mapped cache from a string key to its computed value
+ *
+ * Each key lands in a single slot chosen from its hash, a new key evicts the previous occupant.
+ * The key is stored along with its value so that hash collisions are never returned as hits.
+ * Not thread safe: instances are meant to be used by a single thread.
+ */
+class ValueCache {
+  public:
+    /**
+     * @brief Largest number of slots, about 80 MB of slots per cache
+     */
+    static constexpr std::size_t MAX_CAPACITY = std::size_t(1) << 20U;
+
+    /**
+     * @param capacity Number of slots, rounded up to a power of 2 (0 disables the cache)
+     * @throw std::invalid_argument If capacity is greater than MAX_CAPACITY
+     */
+    explicit ValueCache(std::size_t capacity = 0);
+
+    /**
+     * @brief Get the value cached for the key
+     *
+     * @param key Key to look for
+     * @param hash Hash of the key
+     * @return const std::string* The cached value, nullptr if the key is not in the cache
+     */
+    const std::string* find(std::string_view key, std::size_t hash);
+
+    /**
+     * @brief Stores the value of the key, evicting the key previously held by the slot
+     *
+     * @param key Key
+     * @param hash Hash of the key
+     * @param value Computed value
+     * @return const std::string& The stored value
+     */
+    const std::string& insert(std::string_view key, std::size_t hash, std::string value);
+
+    /**
+     * @brief Drops all cached values and resets the counters
+     */
+    void clear();
+
+    std::size_t capacity() const { return _slots.size(); }
+    CacheStats stats() const { return _stats; }
+
+  private:
+    struct Slot {
+        bool used = false;
+        std::size_t hash = 0;
+        std::string key;
+        std::string value;
+    };
+
+    std::vector<Slot> _slots;
+    CacheStats _stats = { 0, 0 };
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Enables the memoization of User-Agent, Accept and Accept-Language encoded values
+ *
+ * Each thread gets its own cache of the given capacity per header, allocated on first use.
+ *
+ * @param capacity Number of entries of each per-thread cache
+ * @throw std::invalid_argument If capacity is greater than ValueCache::MAX_CAPACITY
+ */
+void value_cache_enable(std::size_t capacity = 1024); // NOLINT(readability-magic-numbers)
+
+/**
+ * @brief Disables the memoization, caches are released by their thread on next use
+ */
+void value_cache_disable();
+
+/**
+ * @brief Get the counters of the calling thread cache for the given header
+ */
+CacheStats value_cache_stats(CachedHeader header);
+
+/**
+ * @brief Get the cache of the calling thread for the given header
+ *
+ * @param header Header
+ * @param generation Generation of the configuration tables the values are encoded with, the
+ * caches of the thread are cleared when it changes
+ * @return ValueCache* The cache, nullptr if memoization is disabled
+ */
+ValueCache* value_cache(CachedHeader header, std::uint64_t generation = 0);
+
+/**
+ * @brief Enables the memoization of whole header blocks fingerprints
+ *
+ * The key of a block is made of the header names, in order, and of the values of the headers that
+ * are encoded in the fingerprint only, so that cookies, lengths, referers... do not split entries.
+ * Each thread gets its own cache of the given capacity, allocated on first use.
+ *
+ * @param capacity Number of entries of each per-thread cache
+ * @throw std::invalid_argument If capacity is greater than ValueCache::MAX_CAPACITY
+ */
+void header_cache_enable(std::size_t capacity = 1024); // NOLINT(readability-magic-numbers)
+
+/**
+ * @brief Disables the header block memoization, caches are released by their thread on next use
+ */
+void header_cache_disable();
+
+/**
+ * @brief Get the counters of the calling thread header block cache
+ */
+CacheStats header_cache_stats();
+
+/**
+ * @brief Get the header block cache of the calling thread
+ *
+ * @param generation Generation of the configuration tables the blocks are encoded with, the cache
+ * is cleared when it changes
+ * @return ValueCache* The cache, nullptr if header block memoization is disabled
+ */
+ValueCache* header_cache(std::uint64_t generation = 0);
+
+#endif // FINGER_CACHE_HPP
@@ -0,0 +1,195 @@
+/**
+ * @file distance.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the distance between fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_DISTANCE_HPP
+#define FINGER_DISTANCE_HPP
+
+#include <array>
+#include <cstdint>
+#include <finger/configs.hpp>
+#include <finger/masks.hpp>
+#include <span>
+#include <string_view>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Feature of a parsed fingerprint
+ */
+struct FingerprintField {
+    /**
+     * @brief Whether the feature is empty in the fingerprint
+     */
+    bool empty = true;
+
+    /**
+     * @brief Whether the feature holds a number
+     */
+    bool numeric = false;
+
+    /**
+     * @brief Value of the feature, if numeric
+     */
+    double number = 0;
+
+    /**
+     * @brief Hash of the text of the feature
+     */
+    std::uint32_t hash = 0;
+};
+
+/**
+ * @brief Fingerprint parsed once for repeated comparisons: numbers are decoded and strings hashed,
+ * header lists are split in hashed tokens
+ */
+class Fingerprint {
+  public:
+    /**
+     * @param text Fingerprint, as computed by fingerprint<Mode>() (or fingerprint() for
+     * FULL_FEATURES)
+     * @param mode Features of the fingerprint
+     * @throw std::invalid_argument If the number of fields does not match the mode
+     */
+    Fingerprint(std::string_view text, const FeatureTypes& mode);
+
+    /**
+     * @brief Features of the fingerprint
+     */
+    const FeatureTypes& mode() const { return _mode; }
+
+    /**
+     * @brief Parsed feature, empty if the mode does not use it
+     */
+    const FingerprintField& field(std::size_t feature) const { return _fields[feature]; }
+
+    /**
+     * @brief Hashes of the header names, in order
+     */
+    std::span<const std::uint32_t> headerOrder() const { return _order; }
+
+    /**
+     * @brief Hashes of the encoded header values, sorted and without duplicates
+     */
+    std::span<const std::uint32_t> headerValues() const { return _values; }
+
+    /**
+     * @brief Known headers of the header order, empty if the mode does not use it
+     */
+    const HeaderMasks& headerMasks() const { return _masks; }
+
+    /**
+     * @brief Tokens of the enumerable header values, empty if the mode does not use them
+     *
+     * They sit next to headerValues(), which distance() keeps comparing: the bitsets only cover
+     * the VALUE_HEADERS whose values are made of known tokens, the other values need their hashes.
+     */
+    const ValueBits& valueBits() const { return _valueBits; }
+
+  private:
+    FeatureTypes _mode;
+    std::array<FingerprintField, FEATURE_COUNT> _fields {};
+    std::vector<std::uint32_t> _order;
+    std::vector<std::uint32_t> _values;
+    HeaderMasks _masks;
+    ValueBits _valueBits;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Computes the distance between two fingerprints over the features of a mode
+ *
+ * Each feature used by the mode gives a distance between 0 and 1, according to its type:
+ * - header order: normalized edit distance between the header lists, see
+ *   normalizedEditDistance()
+ * - header values: Jaccard distance between the sets of encoded values
+ * - 's': 0 if the features are equal, 1 otherwise
+ * - 'i' and 'f': absolute difference divided by the largest absolute value (at least 1), capped
+ *   to 1
+ * Two empty features are equal, an empty and a non empty feature are at distance 1. The distance
+ * is the mean of the features distances, a metric over the fingerprints.
+ *
+ * @param a First fingerprint
+ * @param b Second fingerprint
+ * @param mode Features to compare, must be used by both fingerprints
+ * @return double The distance, between 0 (same features) and 1
+ * @throw std::invalid_argument If a feature of the mode is not in both fingerprints
+ */
+double distance(const Fingerprint& a, const Fingerprint& b, const FeatureTypes& mode);
+
+/**
+ * @brief Computes the distance between two fingerprints over all their features
+ *
+ * @param a First fingerprint
+ * @param b Second fingerprint, of the same mode
+ * @return double The distance, between 0 (same features) and 1
+ * @throw std::invalid_argument If the fingerprints are not of the same mode
+ */
+double distance(const Fingerprint& a, const Fingerprint& b);
+
+/**
+ * @brief Computes the distance between two fingerprints of a mode, parsing them first
+ * @note Parse the fingerprints once with Fingerprint to compare them several times
+ *
+ * @param a First fingerprint
+ * @param b Second fingerprint
+ * @param mode Features of the fingerprints
+ * @return double The distance, between 0 (same features) and 1
+ */
+double distance(std::string_view a, std::string_view b, const FeatureTypes& mode);
+
+/**
+ * @brief Computes the edit distance between two sequences of tokens, such as the hashed header
+ * names of the header order
+ *
+ * Sequences of up to 64 tokens are compared with a bit-parallel algorithm (Myers, Hyyrö) in
+ * O(|a| + |b|), the comparison stops as soon as the distance is known to exceed max.
+ *
+ * @param a First sequence
+ * @param b Second sequence
+ * @param max Largest distance of interest
+ * @return std::size_t Minimal number of insertions, deletions and substitutions, or max + 1 if it
+ * is greater than max
+ */
+std::size_t editDistance(std::span<const std::uint32_t> a,
+                         std::span<const std::uint32_t> b,
+                         std::size_t max = SIZE_MAX);
+
+/**
+ * @brief Normalizes an edit distance between 0 and 1, as 2e / (|a| + |b| + e)
+ *
+ * Unlike the division by the longest sequence, this normalization keeps the triangle inequality
+ * (Yujian and Bo), so that distance() is a metric.
+ *
+ * @param edits Edit distance between the sequences
+ * @param a Length of the first sequence
+ * @param b Length of the second sequence
+ * @return double The normalized distance, 0 for two empty sequences
+ */
+constexpr double normalizedEditDistance(std::size_t edits, std::size_t a, std::size_t b) {
+    std::size_t total = a + b + edits;
+
+    return total == 0 ? 0 : 2. * static_cast<double>(edits) / static_cast<double>(total);
+}
+
+/**
+ * @brief Computes the Jaccard distance between two sorted sets of tokens
+ *
+ * @return double 1 - |a ∩ b| / |a ∪ b|, 0 for two empty sets
+ */
+double jaccardDistance(std::span<const std::uint32_t> a, std::span<const std::uint32_t> b);
+
+#endif // FINGER_DISTANCE_HPP
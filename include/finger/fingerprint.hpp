@@ -1,314 +1,562 @@
-/**
- * @file fingerprint.hpp
- * @author Gautier Miquet
- * @brief Declaration of HTTP Fingerprinting methods and objects
- * @version 1.0.0
- * @date 2022-03-03
- */
-
-#ifndef FINGER_FINGERPRINT_HPP
-#define FINGER_FINGERPRINT_HPP
-
-#include <faup/decode.h>
-#include <faup/faup.h>
-#include <faup/options.h>
-#include <faup/output.h>
-#include <finger/configs.hpp>
-#include <json.hpp>
-#include <stdexcept>
-#include <string>
-#include <vector>
-
-#ifdef DEBUG
-#include <iostream>
-#endif
-
-//--------------------------------------------------------------------------------------//
-//                                                                                      //
-//                                        Macros                                        //
-//                                                                                      //
-//--------------------------------------------------------------------------------------//
-
-// ---- Debug print macro ----------------------------------------------------------------
-
-#ifdef DEBUG
-#define D_PRINT(msg) std::cout << "[DEBUG] " << msg << std::endl;
-#else
-#define D_PRINT(msg)
-#endif
-
-//--------------------------------------------------------------------------------------//
-//                                                                                      //
-//                                   Data Structures                                    //
-//                                                                                      //
-//--------------------------------------------------------------------------------------//
-
-/**
- * @brief Data used to forge a fingerprint from an HTTP Request
- */
-struct HTTPRequest {
-    std::string uri;
-    std::string method;
-    std::string version;
-    std::vector<std::string> headers;
-    std::string payload;
-
-    HTTPRequest(std::string uri,
-                std::string method,
-                std::string version,
-                std::vector<std::string> headers,
-                std::string payload = "")
-    : uri(std::move(uri)), method(std::move(method)), version(std::move(version)),
-      headers(std::move(headers)), payload(std::move(payload)) { }
-};
-
-/**
- * @brief Computed data about the directories in the URI path
- */
-struct URIDirectoryData {
-    /**
-     * @brief Number of directories in the path
-     */
-    int count;
-
-    /**
-     * @brief Average size of a directory name
-     */
-    float avg_size;
-
-    /**
-     * @brief log10 of the average size of a directory name
-     */
-    float avg_size_log;
-};
-
-/**
- * @brief Computed data about the queries in the URI
- */
-struct URIQueryData {
-    /**
-     * @brief Size of the query string
-     */
-    int size;
-
-    /**
-     * @brief Number of query parameters
-     */
-    int count;
-
-    /**
-     * @brief Average size of a query parameter
-     */
-    float avg_size;
-
-    /**
-     * @brief log10 of the average size of a query parameter
-     */
-    float avg_size_log;
-};
-
-//--------------------------------------------------------------------------------------//
-//                                                                                      //
-//                                       Methods                                        //
-//                                                                                      //
-//--------------------------------------------------------------------------------------//
-
-//--------------------------------------------------------------------------------------//
-//                               Fingerprint Computation                                //
-//--------------------------------------------------------------------------------------//
-
-/**
- * @brief Computes a fingerprint from an HTTP Request
- *
- * @param req HTTP Request fields
- * @return std::string The computed fingerprint
- */
-std::string fingerprint(const HTTPRequest& req);
-
-/**
- * @brief Computes the fingerprint from the URI, is part of the whole HTTP Request fingerprint
- *
- * @param uri Request URI
- * @return std::string The computed URI fingerprint
- */
-std::string uri_fingerprint(const std::string& uri);
-
-/**
- * @brief Computes the fingerprint field for the HTTP method used, is part of the whole HTTP Request
- * fingerprint
- *
- * @param method Full HTTP method name (GET, POST, DELETE, ...)
- * @return std::string The computed method fingerprint (correspond to the first letter: G, P, D,
- * ...)
- */
-std::string method_fingerprint(const std::string& method);
-
-/**
- * @brief Computes the fingerprint field for the HTTP version used, is part of the whole HTTP
- * Request fingerprint
- *
- * @param version Full HTTP version (1.1, 1.0, ...)
- * @return std::string The computed version fingerprint (correspond to the first digit: 1, ...)
- */
-std::string version_fingerprint(const std::string& version);
-
-/**
- * @brief Computes the fingerprint from the headers, is part of the whole HTTP Request fingerprint
- *
- * @param headers Request headers
- * @return std::string The computed headers fingerprint
- */
-std::string header_fingerprint(const std::vector<std::string>& headers);
-
-/**
- * @brief Computes the fingerprint from the payload, is part of the whole HTTP Request fingerprint
- *
- * @param payload Full string encoded payload
- * @return std::string The computed payload fingerprint
- */
-std::string payload_fingerprint(const std::string& payload);
-
-// ---- Submethods -----------------------------------------------------------------------
-
-/**
- * @brief Fowler–Noll–Vo hash function (non cryptographic hash)
- *
- * @param str String to hash
- * @return std::string Hashed string
- */
-std::string fnv1a_32(const std::string& str);
-
-// Headers
-
-/**
- * @brief Get the hex value for usual header
- *
- * @param header Header
- * @param headerName Name of the header
- * @param headerValueTable Values table for the header
- * @return std::string Hex value of the header
- */
-std::string getHeaderValue(const std::string& header,
-                           const std::string& headerName,
-                           const std::map<std::string, std::string>& headerValueTable);
-
-/**
- * @brief Get the hex value from Content-Type header
- *
- * @param header Content-Type header
- * @return std::string Hex value of the Content-Type header
- */
-std::string getContentType(const std::string& header);
-
-/**
- * @brief Get the hex value from Accept-Language header
- *
- * @param header Accept-Language header
- * @return std::string Hex value of the Accept-Language header
- */
-std::string getAcceptLanguageValue(const std::string& header);
-
-/**
- * @brief Get the hex value from User-Agent header
- *
- * @param header User-Agent header
- * @return std::string Hex value of the User-Agent header
- */
-std::string getUaValue(const std::string& header);
-
-/**
- * @brief Get the case of the header
- *
- * @return true If the header is in upper case
- * @return false Otherwise
- */
-bool getHeaderCase(const std::string& header);
-
-/**
- * @brief Get the order of the headers
- */
-std::string getHeaderOrder(const std::vector<std::string>& headers);
-
-
-// URI
-
-/**
- * @brief Decodes a hexadecimal-encoded string (adaptation of POCO::decode)
- * @note
- * https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L669
- * @param str Encoded string
- * @param decodedStr Decoded string
- * @return void
- */
-void decode(const std::string& str, std::string& decodedStr);
-
-/**
- * @brief Parses query parameters and values from given query
- * @note
- * https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L373
- * @param query
- * @return std::vector <std::pair<std::string, std::string>> list of key-value pairs (parameters and
- * their values)
- */
-std::vector<std::pair<std::string, std::string>> get_query_parameters(const std::string& query);
-
-/**
- * @brief Computes the average length of the directory in the path, keeps in track the size of the
- * path and the average value in log10
- *
- * @param path URI Path
- * @return URIDirectoryData The results containing the path size, average directory size and average
- * directory size in log10
- */
-URIDirectoryData compute_uri_directory_data(const std::string& path);
-
-/**
- * @brief Computes the query string size and average value size in log10
- *
- * @param uri Parsed Poco URI
- * @param faup_handler_t Faup handler containing parsed uri
- * @return URIQueryData The results containing the query string size, query count, average query
- * value size and average query value size in log10
- */
-URIQueryData compute_uri_query_data(const std::string& uri, faup_handler_t* fh);
-
-/**
- * @brief Computes the extension used in the URI from the path
- *
- * @param path URI Path
- * @return std::string The extensions used, empty if no extension is found
- */
-std::string compute_uri_extention(const std::string& path);
-
-// Others
-
-/**
- * @brief Computes the entropy of a string
- */
-float entropy(const std::string& str);
-
-//--------------------------------------------------------------------------------------//
-//                                       Helpers                                        //
-//--------------------------------------------------------------------------------------//
-
-/**
- * @brief Computes the occurrences of each character in a string
- */
-std::map<char, int> charOccurrences(const std::string& str);
-
-/**
- * @brief Get length magnitude of the input rounded to 1 decimal
- */
-float log10length(const std::string& str);
-
-/**
- * @brief Get the string representation of the given float with the given precision
- *
- * @param v Float value
- * @param p Precision
- * @return std::string The formatted string
- * @note The precision is the number of digits after the decimal point
- */
-std::string floatPrecision(const float& v, const int& p);
-
-#endif /* FINGER_FINGERPRINT_HPP */
+/**
+ * @file fingerprint.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of HTTP Fingerprinting methods and objects
+ * @version 1.0.0
+ * @date 2022-03-03
+ */
+
+#ifndef FINGER_FINGERPRINT_HPP
+#define FINGER_FINGERPRINT_HPP
+
+#include <array>
+#include <cstdint>
+#include <faup/decode.h>
+#include <faup/faup.h>
+#include <faup/options.h>
+#include <faup/output.h>
+#include <finger/configs.hpp>
+#include <finger/masks.hpp>
+#include <json.hpp>
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef DEBUG
+#include <iostream>
+#endif
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                        Macros                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+// ---- Debug print macro ----------------------------------------------------------------
+
+#ifdef DEBUG
+#define D_PRINT(msg) std::cout << "[DEBUG] " << msg << std::endl;
+#else
+#define D_PRINT(msg)
+#endif
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Data used to forge a fingerprint from an HTTP Request
+ */
+struct HTTPRequest {
+    std::string uri;
+    std::string method;
+    std::string version;
+    std::vector<std::string> headers;
+    std::string payload;
+
+    HTTPRequest(std::string uri,
+                std::string method,
+                std::string version,
+                std::vector<std::string> headers,
+                std::string payload = "")
+    : uri(std::move(uri)), method(std::move(method)), version(std::move(version)),
+      headers(std::move(headers)), payload(std::move(payload)) { }
+};
+
+/**
+ * @brief Header as a name/value pair, as handed by HTTP servers that already parsed the request
+ * (the value does not hold the space following the colon)
+ */
+using HeaderField = std::pair<std::string_view, std::string_view>;
+
+/**
+ * @brief View over the name and value of a header, whether it comes from a header line or a
+ * name/value pair
+ */
+struct HeaderView {
+    /**
+     * @brief Header name, as written in the request
+     */
+    std::string_view name;
+
+    /**
+     * @brief Text following the name colon up to the next colon, without the space usually
+     * following the colon
+     */
+    std::string_view value;
+
+    /**
+     * @brief Whether the value was preceded by a space (always the case for name/value pairs)
+     */
+    bool spaced;
+};
+
+/**
+ * @brief Number of distinct byte values
+ */
+constexpr std::size_t BYTE_VALUES = 256;
+
+/**
+ * @brief Occurrences of each byte value, indexed by unsigned byte value
+ */
+using ByteHistogram = std::array<std::uint64_t, BYTE_VALUES>;
+
+/**
+ * @brief Computed data about the directories in the URI path
+ */
+struct URIDirectoryData {
+    /**
+     * @brief Number of directories in the path
+     */
+    int count;
+
+    /**
+     * @brief Average size of a directory name
+     */
+    float avg_size;
+
+    /**
+     * @brief log10 of the average size of a directory name
+     */
+    float avg_size_log;
+};
+
+/**
+ * @brief Computed data about the queries in the URI
+ */
+struct URIQueryData {
+    /**
+     * @brief Size of the query string
+     */
+    int size;
+
+    /**
+     * @brief Number of query parameters
+     */
+    int count;
+
+    /**
+     * @brief Average size of a query parameter
+     */
+    float avg_size;
+
+    /**
+     * @brief log10 of the average size of a query parameter
+     */
+    float avg_size_log;
+};
+
+/**
+ * @brief Parts of the URI decoded by faup
+ */
+struct URIParts {
+    /**
+     * @brief Resource path
+     */
+    std::string path;
+
+    /**
+     * @brief Computed data about the queries, zeroed when not requested
+     */
+    URIQueryData query;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+//--------------------------------------------------------------------------------------//
+//                               Fingerprint Computation                                //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Computes a fingerprint from an HTTP Request
+ *
+ * @param req HTTP Request fields
+ * @return std::string The computed fingerprint
+ */
+std::string fingerprint(const HTTPRequest& req);
+
+/**
+ * @brief Computes the fingerprint from the URI, is part of the whole HTTP Request fingerprint
+ *
+ * @param uri Request URI
+ * @return std::string The computed URI fingerprint
+ */
+std::string uri_fingerprint(const std::string& uri);
+
+/**
+ * @brief Decodes the URI with faup
+ *
+ * @param uri Request URI
+ * @param query Whether the query data should be computed
+ * @return URIParts The path of the URI, and its query data if requested
+ */
+URIParts parse_uri(const std::string& uri, bool query);
+
+/**
+ * @brief Computes the fingerprint field for the HTTP method used, is part of the whole HTTP Request
+ * fingerprint
+ *
+ * @param method Full HTTP method name (GET, POST, DELETE, ...)
+ * @return std::string The computed method fingerprint (correspond to the first letter: G, P, D,
+ * ...)
+ */
+std::string method_fingerprint(const std::string& method);
+
+/**
+ * @brief Computes the fingerprint field for the HTTP version used, is part of the whole HTTP
+ * Request fingerprint
+ *
+ * @param version Full HTTP version (1.1, 1.0, ...)
+ * @return std::string The computed version fingerprint (correspond to the first digit: 1, ...)
+ */
+std::string version_fingerprint(const std::string& version);
+
+/**
+ * @brief Computes the fingerprint from the headers, is part of the whole HTTP Request fingerprint
+ *
+ * @param headers Request headers
+ * @return std::string The computed headers fingerprint
+ */
+std::string header_fingerprint(const std::vector<std::string>& headers);
+
+/**
+ * @brief Computes the fingerprint from headers already split in name/value pairs, gives the same
+ * result as the header lines "Name: value"
+ *
+ * @param headers Request headers as name/value pairs
+ * @return std::string The computed headers fingerprint
+ */
+std::string header_fingerprint(std::span<const HeaderField> headers);
+
+/**
+ * @brief Computes the headers fingerprint from header views, both header_fingerprint() end up here
+ * @note The result is memoized when the header block cache is enabled (see header_cache_enable())
+ *
+ * @param headers Request headers views
+ * @return std::string The computed headers fingerprint
+ */
+std::string encodeHeaders(const std::vector<HeaderView>& headers);
+
+/**
+ * @brief Computes the encoded values of the headers, the second field of the headers fingerprint
+ *
+ * @param headers Request headers views
+ * @return std::string The encoded values, separated by "/"
+ */
+std::string encodeHeaderValues(const std::vector<HeaderView>& headers);
+
+/**
+ * @brief Computes the key identifying a header block in the header block cache: the names of the
+ * headers, in order, and the values of the headers encoded in the fingerprint
+ *
+ * @param headers Request headers views
+ * @param key Output key, cleared first
+ */
+void headerBlockKey(const std::vector<HeaderView>& headers, std::string& key);
+
+/**
+ * @brief Computes the fingerprint from the payload, is part of the whole HTTP Request fingerprint
+ *
+ * @param payload Full string encoded payload
+ * @return std::string The computed payload fingerprint
+ * @note Use PayloadAccumulator (finger/payload.hpp) to fingerprint a body received in chunks
+ */
+std::string payload_fingerprint(const std::string& payload);
+
+// ---- Submethods -----------------------------------------------------------------------
+
+/**
+ * @brief Fowler–Noll–Vo hash function (non cryptographic hash)
+ *
+ * @param str String to hash
+ * @return std::string Hashed string
+ */
+std::string fnv1a_32(const std::string& str);
+
+/**
+ * @brief FNV-1a offset basis, initial value of the hash
+ */
+constexpr std::uint32_t FNV1A_32_OFFSET_BASIS = 2166136261U; // NOLINT(readability-magic-numbers)
+
+/**
+ * @brief Feeds a string to a running Fowler–Noll–Vo hash
+ *
+ * @param hash Current hash value (FNV1A_32_OFFSET_BASIS to start a new hash)
+ * @param str String to hash
+ * @return std::uint32_t Updated hash value
+ */
+std::uint32_t fnv1a_32_update(std::uint32_t hash, std::string_view str);
+
+/**
+ * @brief Get the lowercase hexadecimal representation of a value
+ */
+std::string hexString(std::uint32_t value);
+
+/**
+ * @brief Get the hexadecimal representation of the Fowler–Noll–Vo hash of a string, the usual
+ * encoding of unknown values
+ */
+std::string hexHash(std::string_view str);
+
+// Headers
+
+/**
+ * @brief Splits a header line in its name and value
+ *
+ * @param line Header line ("Name: value")
+ * @return HeaderView Views over the name and value, the value is empty if the line has no colon
+ */
+HeaderView splitHeaderLine(std::string_view line);
+
+/**
+ * @brief Get the view over a name/value pair header
+ */
+HeaderView headerFieldView(const HeaderField& field);
+
+/**
+ * @brief Get the string without its leading and trailing whitespaces
+ */
+std::string_view trimView(std::string_view str);
+
+/**
+ * @brief Get the string without its leading whitespaces
+ */
+std::string_view trimLeftView(std::string_view str);
+
+/**
+ * @brief Get the hex value for usual header
+ *
+ * @param header Header
+ * @param headerName Name of the header
+ * @param headerValueTable Values table for the header
+ * @return std::string Hex value of the header
+ */
+std::string getHeaderValue(const std::string& header,
+                           const std::string& headerName,
+                           FrozenMapView headerValueTable);
+
+/**
+ * @brief Get the hex value for usual header from its trimmed value
+ *
+ * Compound values are tokenized in a single pass without building intermediate strings, a value
+ * with an unknown token or a quality parameter is encoded as a hash
+ *
+ * @param val Trimmed header value
+ * @param headerName Name of the header (lowercase)
+ * @param headerValueTable Values table for the header
+ * @return std::string Hex value of the header
+ */
+std::string encodeHeaderValue(std::string_view val,
+                              const std::string& headerName,
+                              FrozenMapView headerValueTable);
+
+/**
+ * @brief Checks if a token of a compound value holds a quality parameter (";q=" or "; q=")
+ */
+bool hasQualityParameter(std::string_view token);
+
+/**
+ * @brief Get the hex value from Content-Type header
+ *
+ * @param header Content-Type header
+ * @return std::string Hex value of the Content-Type header
+ */
+std::string getContentType(const std::string& header);
+
+/**
+ * @brief Get the hex value from Content-Type trimmed value
+ */
+std::string encodeContentType(std::string_view val);
+
+/**
+ * @brief Get the hex value from Accept-Language header
+ *
+ * @param header Accept-Language header
+ * @return std::string Hex value of the Accept-Language header
+ */
+std::string getAcceptLanguageValue(const std::string& header);
+
+/**
+ * @brief Get the hex value from Accept-Language header view (the value is not trimmed)
+ */
+std::string encodeAcceptLanguage(const HeaderView& header);
+
+/**
+ * @brief Get the hex value from User-Agent header
+ *
+ * @param header User-Agent header
+ * @return std::string Hex value of the User-Agent header
+ */
+std::string getUaValue(const std::string& header);
+
+/**
+ * @brief Get the hex value from User-Agent trimmed value
+ */
+std::string encodeUa(std::string_view val);
+
+/**
+ * @brief Get the case of the header
+ *
+ * @note Single pass and allocation free (SWAR), only ASCII letters are considered
+ * @return true If the header is in upper case
+ * @return false Otherwise
+ */
+bool getHeaderCase(std::string_view header);
+
+/**
+ * @brief Get the case of all the headers of a request at once
+ *
+ * @param headers Request headers views
+ * @param cases Output, cases[i] is the case of headers[i] (see getHeaderCase())
+ * @throw std::invalid_argument If cases is smaller than headers
+ */
+void getHeaderCases(std::span<const HeaderView> headers, std::span<bool> cases);
+
+/**
+ * @brief Get the order of the headers
+ */
+std::string getHeaderOrder(const std::vector<std::string>& headers);
+
+/**
+ * @brief Get the order of the headers from header views
+ */
+std::string encodeHeaderOrder(const std::vector<HeaderView>& headers);
+
+/**
+ * @brief Get the masks of the known headers from header views
+ */
+HeaderMasks encodeHeaderMasks(const std::vector<HeaderView>& headers);
+
+/**
+ * @brief Get the value bitsets of the VALUE_HEADERS from header views
+ */
+ValueBits encodeValueBits(const std::vector<HeaderView>& headers);
+
+
+// URI
+
+/**
+ * @brief Decodes a hexadecimal-encoded string (adaptation of POCO::decode)
+ * @note
+ * https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L669
+ * @param str Encoded string
+ * @param decodedStr Decoded string
+ * @return void
+ */
+void decode(const std::string& str, std::string& decodedStr);
+
+/**
+ * @brief Parses query parameters and values from given query
+ * @note
+ * https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L373
+ * @param query
+ * @return std::vector <std::pair<std::string, std::string>> list of key-value pairs (parameters and
+ * their values)
+ */
+std::vector<std::pair<std::string, std::string>> get_query_parameters(const std::string& query);
+
+/**
+ * @brief Computes the average length of the directory in the path, keeps in track the size of the
+ * path and the average value in log10
+ *
+ * @param path URI Path
+ * @return URIDirectoryData The results containing the path size, average directory size and average
+ * directory size in log10
+ */
+URIDirectoryData compute_uri_directory_data(const std::string& path);
+
+/**
+ * @brief Computes the query string size and average value size in log10
+ *
+ * @param uri Parsed Poco URI
+ * @param faup_handler_t Faup handler containing parsed uri
+ * @return URIQueryData The results containing the query string size, query count, average query
+ * value size and average query value size in log10
+ */
+URIQueryData compute_uri_query_data(const std::string& uri, faup_handler_t* fh);
+
+/**
+ * @brief Computes the extension used in the URI from the path
+ *
+ * @param path URI Path
+ * @return std::string The extensions used, empty if no extension is found
+ */
+std::string compute_uri_extention(const std::string& path);
+
+// Others
+
+/**
+ * @brief Computes the entropy of a string
+ */
+float entropy(const std::string& str);
+
+/**
+ * @brief Computes the entropy, rounded to 1 decimal, from the occurrences of each byte value
+ *
+ * @param counts Occurrences of each byte value
+ * @param size Total number of bytes
+ * @return float The entropy, the same value as entropy() on the counted string
+ */
+float histogramEntropy(const ByteHistogram& counts, std::uint64_t size);
+
+//--------------------------------------------------------------------------------------//
+//                                       Helpers                                        //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Computes the occurrences of each character in a string
+ */
+std::map<char, int> charOccurrences(const std::string& str);
+
+/**
+ * @brief Adds the occurrences of each byte value in a string to the histogram
+ *
+ * @param str String to count
+ * @param counts Histogram, indexed by unsigned byte value
+ */
+void byteOccurrences(std::string_view str, ByteHistogram& counts);
+
+/**
+ * @brief Get length magnitude of the input rounded to 1 decimal
+ */
+float log10length(const std::string& str);
+
+/**
+ * @brief Get length magnitude rounded to 1 decimal
+ *
+ * @note The bucket is found with integer compares against a table of the smallest length of each
+ * bucket, the result is the same as rounding log10f(length)
+ */
+float log10length(std::uint64_t length);
+
+/**
+ * @brief Get the string representation of the given float with the given precision
+ *
+ * @param v Float value
+ * @param p Precision
+ * @return std::string The formatted string
+ * @note The precision is the number of digits after the decimal point, the decimal separator is
+ * always '.' whatever the global locale
+ */
+std::string floatPrecision(const float& v, const int& p);
+
+/**
+ * @brief Get the string representation of the given float as a default formatted stream would
+ * print it (6 significant digits), whatever the global locale
+ *
+ * @param v Float value
+ * @return std::string The formatted string
+ */
+std::string floatString(const float& v);
+
+#endif /* FINGER_FINGERPRINT_HPP */
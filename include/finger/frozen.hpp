@@ -0,0 +1,284 @@
+/**
+ * @file frozen.hpp
+ * @author Gautier Miquet
+ * @brief Compile-time built, read-only lookup tables used for the values mapping
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_FROZEN_HPP
+#define FINGER_FROZEN_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Key/value pair stored in a frozen table
+ */
+struct FrozenEntry {
+    std::string_view key;
+    std::string_view value;
+};
+
+/**
+ * @brief Seeded FNV-1a hash used to place the keys of a frozen table
+ *
+ * @param str String to hash
+ * @param seed Seed mixed in the offset basis
+ * @return std::uint32_t Hash of the string
+ */
+constexpr std::uint32_t frozen_hash(std::string_view str, std::uint32_t seed) {
+    std::uint32_t hash = 2166136261U ^ seed; // NOLINT(readability-magic-numbers)
+
+    for (const char& c: str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619U; // NOLINT(readability-magic-numbers)
+    }
+
+    return hash ^ (hash >> 15U); // NOLINT(readability-magic-numbers)
+}
+
+/**
+ * @brief Number of slots of a frozen table holding N entries (power of 2, at least 4 times N)
+ */
+constexpr std::size_t frozen_capacity(std::size_t n) {
+    std::size_t cap = 8; // NOLINT(readability-magic-numbers)
+
+    while (cap < 4 * n) {
+        cap *= 2;
+    }
+
+    return cap;
+}
+
+/**
+ * @brief Fills the slots of a frozen table using the given seed
+ *
+ * @param entries Entries of the table
+ * @param n Number of entries
+ * @param slots Slots of the table, hold the index of their entry + 1 (0 meaning empty slot)
+ * @param cap Number of slots, power of 2 greater than n
+ * @param seed Seed of the hash
+ * @return std::size_t Number of entries that did not land in their first slot
+ */
+constexpr std::size_t frozen_place(const FrozenEntry* entries,
+                                   std::size_t n,
+                                   std::uint16_t* slots,
+                                   std::size_t cap,
+                                   std::uint32_t seed) {
+    std::size_t collisions = 0;
+
+    for (std::size_t i = 0; i < cap; i++) {
+        slots[i] = 0;
+    }
+
+    for (std::size_t k = 0; k < n; k++) {
+        std::size_t i = frozen_hash(entries[k].key, seed) & (cap - 1);
+
+        if (slots[i] != 0) {
+            collisions++;
+        }
+
+        while (slots[i] != 0) {
+            i = (i + 1) & (cap - 1);
+        }
+
+        slots[i] = static_cast<std::uint16_t>(k + 1);
+    }
+
+    return collisions;
+}
+
+/**
+ * @brief Fills the slots of a frozen table, with the seed giving the less collisions
+ *
+ * Used at compile time by FrozenMap, and at run time for the tables loaded from a file.
+ *
+ * @return std::uint32_t The seed used to fill the slots
+ */
+constexpr std::uint32_t
+frozen_build(const FrozenEntry* entries, std::size_t n, std::uint16_t* slots, std::size_t cap) {
+    // Look for a seed without collisions, keeps the one with the less collisions otherwise.
+    // Large tables almost never get a collision-free seed, only a few are tried to keep them
+    // cheap to compile.
+    const std::uint32_t max_seeds = cap <= 1024 ? 4096 : 8; // NOLINT(readability-magic-numbers)
+    std::size_t best_collisions = n + 1;
+    std::uint32_t best_seed = 0;
+
+    for (std::uint32_t seed = 0; seed < max_seeds && best_collisions != 0; seed++) {
+        std::size_t collisions = frozen_place(entries, n, slots, cap, seed);
+
+        if (collisions < best_collisions) {
+            best_collisions = collisions;
+            best_seed = seed;
+        }
+    }
+
+    frozen_place(entries, n, slots, cap, best_seed);
+
+    return best_seed;
+}
+
+/**
+ * @brief Non-owning, type erased view over a FrozenMap, used to pass any table to a lookup method
+ */
+class FrozenMapView {
+  public:
+    constexpr FrozenMapView(const FrozenEntry* entries,
+                            std::size_t size,
+                            const std::uint16_t* slots,
+                            std::size_t mask,
+                            std::uint32_t seed)
+    : _entries(entries), _size(size), _slots(slots), _mask(mask), _seed(seed) { }
+
+    /**
+     * @brief Get the value mapped to the key
+     *
+     * @param key Key to look for
+     * @return std::string_view The mapped value, empty if the key is not in the table
+     * @note The seed is chosen when the table is built so that keys do not collide, the lookup is
+     * then done in a single probe, the linear probing is only a fallback
+     */
+    constexpr std::string_view find(std::string_view key) const {
+        std::size_t i = index(key);
+
+        return i != _size ? _entries[i].value : std::string_view();
+    }
+
+    /**
+     * @brief Get the position of the key in the entries, in declaration order
+     *
+     * @param key Key to look for
+     * @return std::size_t The index of the entry, size() if the key is not in the table
+     */
+    constexpr std::size_t index(std::string_view key) const {
+        std::size_t i = frozen_hash(key, _seed) & _mask;
+
+        while (_slots[i] != 0) {
+            std::size_t entry = _slots[i] - 1;
+
+            if (_entries[entry].key == key) {
+                return entry;
+            }
+
+            i = (i + 1) & _mask;
+        }
+
+        return _size;
+    }
+
+    /**
+     * @brief Checks if the key is in the table
+     */
+    constexpr bool contains(std::string_view key) const { return !find(key).empty(); }
+
+    constexpr std::size_t size() const { return _size; }
+    constexpr const FrozenEntry* begin() const { return _entries; }
+    constexpr const FrozenEntry* end() const { return _entries + _size; }
+
+  private:
+    const FrozenEntry* _entries;
+    std::size_t _size;
+    const std::uint16_t* _slots;
+    std::size_t _mask;
+    std::uint32_t _seed;
+};
+
+/**
+ * @brief Read-only hash table built at compile time
+ *
+ * The entries are kept in declaration order in a contiguous array, the open addressing slots only
+ * hold their index (+1, 0 meaning empty slot). Declared constexpr, the whole table is placed in
+ * read-only data and requires no initialization at load time.
+ *
+ * @tparam N Number of entries
+ * @tparam Cap Number of slots
+ */
+template<std::size_t N, std::size_t Cap = frozen_capacity(N)>
+class FrozenMap {
+    static_assert((Cap & (Cap - 1)) == 0, "FrozenMap capacity must be a power of 2");
+    static_assert(N < Cap && Cap <= UINT16_MAX, "FrozenMap capacity out of bounds");
+
+  public:
+    constexpr explicit FrozenMap(const FrozenEntry (&entries)[N]) {
+        for (std::size_t i = 0; i < N; i++) {
+            _entries[i] = entries[i];
+        }
+
+        _seed = frozen_build(_entries.data(), N, _slots.data(), Cap);
+    }
+
+    constexpr std::string_view find(std::string_view key) const { return view().find(key); }
+    constexpr bool contains(std::string_view key) const { return view().contains(key); }
+    constexpr std::size_t index(std::string_view key) const { return view().index(key); }
+
+    constexpr std::size_t size() const { return N; }
+    constexpr const FrozenEntry* begin() const { return _entries.data(); }
+    constexpr const FrozenEntry* end() const { return _entries.data() + N; }
+
+    constexpr FrozenMapView view() const {
+        return { _entries.data(), N, _slots.data(), Cap - 1, _seed };
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    constexpr operator FrozenMapView() const { return view(); }
+
+  private:
+    std::array<FrozenEntry, N> _entries {};
+    std::array<std::uint16_t, Cap> _slots {};
+    std::uint32_t _seed = 0;
+};
+
+/**
+ * @brief Builds a FrozenMap from a list of key/value pairs
+ *
+ * @param entries Key/value pairs, keys must be unique
+ * @return FrozenMap<N> The frozen table
+ */
+template<std::size_t N>
+constexpr FrozenMap<N> frozen_map(const FrozenEntry (&entries)[N]) {
+    return FrozenMap<N>(entries);
+}
+
+/**
+ * @brief Builds a FrozenMap holding a set of keys, each key is mapped to itself
+ *
+ * @param keys Keys, must be unique and not empty
+ * @return FrozenMap<N> The frozen table, contains() tells if a key is in the set
+ */
+template<std::size_t N>
+constexpr FrozenMap<N> frozen_set(const std::string_view (&keys)[N]) {
+    FrozenEntry entries[N] {}; // NOLINT(modernize-avoid-c-arrays)
+
+    for (std::size_t i = 0; i < N; i++) {
+        entries[i] = { keys[i], keys[i] };
+    }
+
+    return FrozenMap<N>(entries);
+}
+
+/**
+ * @brief Builds the inverse of a FrozenMap, mapping each value to its key
+ *
+ * @param map Table, its values must be unique and not empty
+ * @return FrozenMap<N> The inverse table, with the entries in the same order
+ */
+template<std::size_t N>
+constexpr FrozenMap<N> frozen_inverse(const FrozenMap<N>& map) {
+    FrozenEntry entries[N] {}; // NOLINT(modernize-avoid-c-arrays)
+
+    for (std::size_t i = 0; i < N; i++) {
+        entries[i] = { map.begin()[i].value, map.begin()[i].key };
+    }
+
+    return FrozenMap<N>(entries);
+}
+
+#endif // FINGER_FROZEN_HPP
@@ -0,0 +1,182 @@
+/**
+ * @file hnsw.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the HNSW graph, an approximate nearest neighbours index of fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_HNSW_HPP
+#define FINGER_HNSW_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <finger/configs.hpp>
+#include <finger/distance.hpp>
+#include <finger/store.hpp>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Parameters of an HNSWIndex
+ */
+struct HNSWParams {
+    /**
+     * @brief Links kept per fingerprint on the upper layers, twice as many on the bottom layer.
+     * More links improve the recall, at the cost of memory and insertion time.
+     */
+    std::size_t m = 16; // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Candidates considered when linking a new fingerprint, higher builds a better graph
+     */
+    std::size_t ef_construction = 100; // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Candidates considered by a query, at least k, the main recall/latency trade-off
+     */
+    std::size_t ef_search = 50; // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Seed of the layers drawn for the fingerprints
+     */
+    std::uint64_t seed = 1;
+};
+
+/**
+ * @brief Hierarchical navigable small world graph (Malkov and Yashunin) over reference
+ * fingerprints, for approximate nearest neighbours with distance()
+ *
+ * Each fingerprint is linked to close ones on the bottom layer, and on a few upper layers holding
+ * exponentially fewer fingerprints. A query walks greedily down the layers, then explores the
+ * bottom layer with a beam of ef candidates: it compares O(log n) fingerprints instead of all of
+ * them, but may miss some of the true neighbours.
+ *
+ * Fingerprints can be added from several threads, while others query the index. The storage is
+ * sized once for the given capacity.
+ *
+ * @code
+ * HNSWIndex index(FULL_FEATURES, references.size());
+ *
+ * for (const std::string& fp: references) {
+ *     index.add(fp);
+ * }
+ *
+ * std::vector<TableMatch> nearest = index.knn(Fingerprint(query, FULL_FEATURES), 10);
+ * @endcode
+ */
+class HNSWIndex {
+  public:
+    /**
+     * @param mode Features of the fingerprints
+     * @param capacity Largest number of fingerprints
+     * @param params Parameters of the graph
+     * @throw std::invalid_argument If m is lower than 2, or if capacity is 2^32 - 1 or more
+     */
+    HNSWIndex(const FeatureTypes& mode, std::size_t capacity, const HNSWParams& params = {});
+    ~HNSWIndex();
+
+    HNSWIndex(const HNSWIndex&) = delete;
+    HNSWIndex& operator=(const HNSWIndex&) = delete;
+
+    /**
+     * @brief Features of the fingerprints
+     */
+    const FeatureTypes& mode() const { return _mode; }
+
+    /**
+     * @brief Parameters of the graph
+     */
+    const HNSWParams& params() const { return _params; }
+
+    /**
+     * @brief Largest number of fingerprints
+     */
+    std::size_t capacity() const { return _nodes.size(); }
+
+    /**
+     * @brief Number of fingerprints added, or being added by other threads
+     */
+    std::size_t size() const { return _count.load(); }
+
+    /**
+     * @brief Reference fingerprint, by the ID returned by add()
+     */
+    const std::string& text(std::size_t id) const;
+
+    /**
+     * @brief Adds a reference fingerprint, can be called from several threads at once
+     *
+     * @param fingerprint Fingerprint, of the mode
+     * @return std::size_t ID of the fingerprint, in the order of the calls
+     * @throw std::invalid_argument If the fingerprint does not match the mode
+     * @throw std::length_error If the index is full
+     */
+    std::size_t add(std::string fingerprint);
+
+    /**
+     * @brief Finds approximately the k references closest to the query
+     *
+     * @param query Fingerprint, holding the features of the mode
+     * @param k Number of neighbours
+     * @param ef Candidates considered, params().ef_search if 0, at least k
+     * @return std::vector<TableMatch> Up to k references, by increasing distance, row being their
+     * ID
+     * @throw std::invalid_argument If a feature of the mode is not in the query
+     */
+    std::vector<TableMatch> knn(const Fingerprint& query, std::size_t k, std::size_t ef = 0) const;
+
+    /**
+     * @brief Finds approximately the k references closest to each query, on several threads
+     *
+     * @param queries Fingerprints, holding the features of the mode
+     * @param k Number of neighbours
+     * @param ef Candidates considered, params().ef_search if 0, at least k
+     * @param threads Number of threads used, 0 for one per core
+     * @return std::vector<std::vector<TableMatch>> Neighbours of each query, as knn() returns them
+     * @throw std::invalid_argument If a feature of the mode is not in a query
+     */
+    std::vector<std::vector<TableMatch>> knn(std::span<const Fingerprint> queries, std::size_t k,
+                                             std::size_t ef = 0, std::size_t threads = 0) const;
+
+  private:
+    struct Node;
+    struct Candidate;
+
+    FeatureTypes _mode;
+    HNSWParams _params;
+    double _levelScale;
+
+    std::vector<std::unique_ptr<Node>> _nodes;
+    std::atomic<std::size_t> _count = 0;
+
+    // Entry point of the searches, on the top layer
+    mutable std::mutex _entryLock;
+    std::uint32_t _entry;
+    int _topLevel = -1;
+
+    // Held by a fingerprint raising the top layer while it is linked
+    std::mutex _raiseLock;
+
+    std::size_t maxLinks(int level) const;
+    int drawLevel(std::size_t id) const;
+    const Fingerprint& fingerprint(std::uint32_t id) const;
+
+    std::vector<Candidate> searchLayer(const Fingerprint& query,
+                                       const std::vector<Candidate>& entries, std::size_t ef,
+                                       int level) const;
+    std::vector<Candidate> selectNeighbors(const std::vector<Candidate>& candidates,
+                                           std::size_t m) const;
+    void connect(std::uint32_t from, std::uint32_t to, int level);
+};
+
+#endif // FINGER_HNSW_HPP
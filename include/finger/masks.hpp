@@ -0,0 +1,198 @@
+/**
+ * @file masks.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the bitmasks of the known headers and values of a request
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_MASKS_HPP
+#define FINGER_MASKS_HPP
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <finger/configs.hpp>
+#include <finger/tables.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Number of bits of the header masks, headers of a loaded table past it are left out
+ */
+inline constexpr std::size_t HEADER_MASK_BITS = 64;
+
+/**
+ * @brief Number of bits of the value bitsets, tokens of a loaded table past it are unknown tokens
+ */
+inline constexpr std::size_t VALUE_TOKEN_BITS = 16;
+
+static_assert(HEADERS.size() <= HEADER_MASK_BITS,
+              "Each compiled header needs a bit of the header masks");
+
+/**
+ * @brief Number of headers whose values are a closed set of tokens
+ */
+inline constexpr std::size_t VALUE_HEADER_COUNT = 6;
+
+/**
+ * @brief Headers whose values are a closed set of tokens, and the table of their tokens
+ */
+inline constexpr std::array<std::string_view, VALUE_HEADER_COUNT> VALUE_HEADERS = {
+    "accept-encoding", "connection", "content-encoding", "cache-control", "te", "accept-charset",
+};
+
+inline constexpr std::array<FrozenMapView ConfigTables::*, VALUE_HEADER_COUNT> VALUE_TABLES = {
+    &ConfigTables::ae,        &ConfigTables::conn, &ConfigTables::contenc,
+    &ConfigTables::cachecont, &ConfigTables::te,   &ConfigTables::acceptchar,
+};
+
+static_assert(AE.size() <= VALUE_TOKEN_BITS && CONN.size() <= VALUE_TOKEN_BITS &&
+              CONTENC.size() <= VALUE_TOKEN_BITS && CACHECONT.size() <= VALUE_TOKEN_BITS &&
+              TE.size() <= VALUE_TOKEN_BITS && ACCEPTCHAR.size() <= VALUE_TOKEN_BITS,
+              "Each token of the compiled value tables needs a bit of the value bitsets");
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Known headers of a request, bit i standing for the i-th header of the headers table
+ *
+ * The bits follow the configuration tables in use (see ConfigGuard), as the fingerprints do: masks
+ * computed before and after config_load() are no more comparable than the fingerprints are. Only
+ * the first HEADER_MASK_BITS headers of a loaded table have a bit.
+ */
+struct HeaderMasks {
+    /**
+     * @brief Known headers present in the request
+     */
+    std::uint64_t presence = 0;
+
+    /**
+     * @brief Known headers written in upper case (see getHeaderCase()), a subset of presence
+     */
+    std::uint64_t uppercase = 0;
+
+    bool operator==(const HeaderMasks&) const = default;
+};
+
+/**
+ * @brief Values of the VALUE_HEADERS of a request as sets of tokens, bit j of bits[h] standing for
+ * the j-th token of the VALUE_TABLES[h] table
+ *
+ * Only values made of known tokens, without quality parameters, are represented. As the header
+ * masks, the bits follow the configuration tables in use, and only the first VALUE_TOKEN_BITS
+ * tokens of a loaded table count as known.
+ */
+struct ValueBits {
+    /**
+     * @brief Tokens of each header, valid if the header is in known
+     */
+    std::array<std::uint16_t, VALUE_HEADER_COUNT> bits {};
+
+    /**
+     * @brief Headers whose value is made of known tokens only, bit h for VALUE_HEADERS[h]
+     */
+    std::uint8_t known = 0;
+
+    /**
+     * @brief Headers present with another value, left to the comparison of the encoded values
+     */
+    std::uint8_t unknown = 0;
+
+    /**
+     * @brief Adds a value of a header, its tokens are kept while all the values of the header are
+     * made of known tokens
+     *
+     * @param header Index of the header in VALUE_HEADERS
+     * @param tokens Bits of the tokens of the value
+     * @param all_known Whether the value is made of known tokens only
+     */
+    void add(std::size_t header, std::uint16_t tokens, bool all_known) {
+        auto bit = static_cast<std::uint8_t>(1U << header);
+
+        if (all_known && (unknown & bit) == 0) {
+            bits[header] |= tokens;
+            known |= bit;
+        } else {
+            bits[header] = 0;
+            known &= static_cast<std::uint8_t>(~bit);
+            unknown |= bit;
+        }
+    }
+
+    bool operator==(const ValueBits&) const = default;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Computes the known header masks of a request
+ *
+ * @param headers Request headers, as "Name: value" lines
+ * @return HeaderMasks The masks of the known headers
+ */
+HeaderMasks header_masks(const std::vector<std::string>& headers);
+
+/**
+ * @brief Computes the known header masks from the header order of a fingerprint
+ *
+ * @param order Header order field, shortened names separated by ',' and prefixed by '!' when not
+ * in upper case
+ * @return HeaderMasks The masks of the known headers, same as header_masks() for the request if
+ * the fingerprint was computed with the tables in use
+ */
+HeaderMasks orderMasks(std::string_view order);
+
+/**
+ * @brief Computes the value bitsets of a request
+ *
+ * @param headers Request headers, as "Name: value" lines
+ * @return ValueBits The tokens of the VALUE_HEADERS values
+ */
+ValueBits value_bits(const std::vector<std::string>& headers);
+
+/**
+ * @brief Computes the value bitsets from the header values of a fingerprint
+ *
+ * @param values Header values field, "name:value" entries separated by '/'
+ * @return ValueBits The tokens of the VALUE_HEADERS values, same as value_bits() for the request
+ * if the fingerprint was computed with the tables in use
+ */
+ValueBits valuesBits(std::string_view values);
+
+/**
+ * @brief Similarity of the values of two requests, from their value bitsets
+ *
+ * Each header in either request contributes the Jaccard similarity of its tokens, or 0 if it is
+ * only in one request or only made of known tokens in one of them. Headers with other values in
+ * both requests cannot be compared from the bitsets and are left out.
+ *
+ * @return double The mean similarity of the headers, 1 if none was compared
+ */
+double valueSimilarity(const ValueBits& a, const ValueBits& b);
+
+/**
+ * @brief Jaccard similarity of two masks, |a ∩ b| / |a ∪ b|
+ *
+ * @return double The similarity, 1 for two empty masks
+ */
+constexpr double maskJaccard(std::uint64_t a, std::uint64_t b) {
+    int together = std::popcount(a | b);
+
+    return together == 0 ? 1. : static_cast<double>(std::popcount(a & b)) / together;
+}
+
+/**
+ * @brief Hamming distance of two masks, the number of differing bits
+ */
+constexpr int maskHamming(std::uint64_t a, std::uint64_t b) { return std::popcount(a ^ b); }
+
+#endif // FINGER_MASKS_HPP
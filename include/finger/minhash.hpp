@@ -0,0 +1,197 @@
+/**
+ * @file minhash.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the MinHash signatures of the header tokens and of their LSH index
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_MINHASH_HPP
+#define FINGER_MINHASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <finger/configs.hpp>
+#include <finger/distance.hpp>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Signature of a MinHashIndex similar to a query
+ */
+struct JaccardMatch {
+    std::size_t row;
+    double similarity;
+};
+
+/**
+ * @brief Banded locality-sensitive hashing of MinHash signatures, finding the signatures whose
+ * estimated Jaccard similarity with a query is above a threshold
+ *
+ * The signatures are split in b bands of r hashes. Two sets of Jaccard similarity s agree on a
+ * whole band with probability s^r, and share at least one band with probability 1 - (1 - s^r)^b:
+ * an S-curve rising at about (1 / b)^(1 / r), set to the threshold. Each band hashes the
+ * signatures into buckets, a query only compares the signatures sharing one of its buckets, so its
+ * cost follows the number of similar signatures rather than the size of the index. Signatures
+ * just above the threshold can be missed, those well above it almost never are.
+ *
+ * The index takes 4 bytes per hash of each signature, plus a bucket entry per signature and band.
+ *
+ * @code
+ * MinHashIndex index(0.8);
+ *
+ * for (const std::string& fp: references) {
+ *     index.add(minhash(headerTokens(Fingerprint(fp, FULL_FEATURES)), index.hashes()));
+ * }
+ *
+ * std::vector<JaccardMatch> similar =
+ * index.similar(minhash(header_tokens(req.headers), index.hashes()));
+ * @endcode
+ */
+class MinHashIndex {
+  public:
+    /**
+     * @brief Builds an empty index, with the bands whose S-curve rises at the threshold or just
+     * below it
+     *
+     * @param threshold Lowest Jaccard similarity of the matches, in ]0, 1]
+     * @param hashes Largest number of hashes of the signatures, some may be left out by the bands
+     * @throw std::invalid_argument If the threshold is out of bounds or hashes is 0
+     */
+    explicit MinHashIndex(double threshold, std::size_t hashes = 128);
+
+    /**
+     * @brief Builds an empty index with the given bands
+     *
+     * @param threshold Lowest Jaccard similarity of the matches, in ]0, 1]
+     * @param bands Number of bands
+     * @param rows Number of hashes per band
+     * @throw std::invalid_argument If the threshold is out of bounds or bands or rows is 0
+     */
+    MinHashIndex(double threshold, std::size_t bands, std::size_t rows);
+
+    /**
+     * @brief Lowest Jaccard similarity of the matches
+     */
+    double threshold() const { return _threshold; }
+
+    /**
+     * @brief Number of bands
+     */
+    std::size_t bands() const { return _buckets.size(); }
+
+    /**
+     * @brief Number of hashes per band
+     */
+    std::size_t rows() const { return _rows; }
+
+    /**
+     * @brief Number of hashes of the signatures, bands() * rows()
+     */
+    std::size_t hashes() const { return _buckets.size() * _rows; }
+
+    /**
+     * @brief Number of signatures
+     */
+    std::size_t size() const { return hashes() == 0 ? 0 : _signatures.size() / hashes(); }
+
+    /**
+     * @brief Signature of a row
+     */
+    std::span<const std::uint32_t> signature(std::size_t row) const;
+
+    /**
+     * @brief Adds a signature
+     *
+     * @param signature Signature of hashes() hashes, or more, the extra ones being ignored
+     * @return std::size_t Row of the signature, in the order of the calls
+     * @throw std::invalid_argument If the signature is too short
+     */
+    std::size_t add(std::span<const std::uint32_t> signature);
+
+    /**
+     * @brief Finds the signatures sharing a band with the query, without estimating their
+     * similarity
+     *
+     * @param query Signature of hashes() hashes, or more
+     * @return std::vector<std::size_t> Rows sharing at least a band with the query, sorted
+     * @throw std::invalid_argument If the signature is too short
+     */
+    std::vector<std::size_t> candidates(std::span<const std::uint32_t> query) const;
+
+    /**
+     * @brief Finds the signatures similar to the query
+     *
+     * @param query Signature of hashes() hashes, or more
+     * @return std::vector<JaccardMatch> Candidates whose estimated similarity is at least the
+     * threshold, by decreasing similarity, then row
+     * @throw std::invalid_argument If the signature is too short
+     */
+    std::vector<JaccardMatch> similar(std::span<const std::uint32_t> query) const;
+
+  private:
+    double _threshold;
+    std::size_t _rows;
+
+    std::vector<std::uint32_t> _signatures;
+    std::vector<std::unordered_map<std::uint64_t, std::vector<std::uint32_t>>> _buckets;
+
+    std::uint64_t bandHash(std::span<const std::uint32_t> signature, std::size_t band) const;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Token set of the header order and header values of a fingerprint
+ *
+ * The tokens are the header names of the header order and the encoded header values, told apart
+ * from each other: two client stacks differing by a header differ by a token or two.
+ *
+ * @param fp Fingerprint
+ * @return std::vector<std::uint64_t> The tokens, sorted and without duplicates, empty if the
+ * fingerprint has no header feature
+ */
+std::vector<std::uint64_t> headerTokens(const Fingerprint& fp);
+
+/**
+ * @brief Token set of the headers of a request, as header_fingerprint() gives them
+ *
+ * @param headers Header lines of the request
+ * @return std::vector<std::uint64_t> The tokens, as headerTokens() gives them
+ */
+std::vector<std::uint64_t> header_tokens(const std::vector<std::string>& headers);
+
+/**
+ * @brief Computes the MinHash signature of a token set (Broder)
+ *
+ * Hash i of the signature is the lowest value of the i-th hash function over the tokens: two sets
+ * agree on it with a probability of their Jaccard similarity.
+ *
+ * @param tokens Token set, duplicates do not change the signature
+ * @param hashes Number of hashes of the signature
+ * @return std::vector<std::uint32_t> The signature, all hashes 0xFFFFFFFF for an empty set
+ */
+std::vector<std::uint32_t> minhash(std::span<const std::uint64_t> tokens, std::size_t hashes);
+
+/**
+ * @brief Estimates the Jaccard similarity of two token sets from their MinHash signatures
+ *
+ * @param a Signature
+ * @param b Signature
+ * @return double The share of hashes the signatures agree on, over the shortest signature, 1 if it
+ * is empty
+ */
+double minhashSimilarity(std::span<const std::uint32_t> a, std::span<const std::uint32_t> b);
+
+#endif // FINGER_MINHASH_HPP
@@ -0,0 +1,283 @@
+/**
+ * @file modes.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the fingerprints restricted to the features of a mode
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_MODES_HPP
+#define FINGER_MODES_HPP
+
+#include <array>
+#include <cstddef>
+#include <finger/configs.hpp>
+#include <finger/fingerprint.hpp>
+#include <finger/tables.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Features of an HTTP Request before formatting, shared by the fingerprints of all modes
+ *
+ * Only the features used by the modes they were extracted for are filled.
+ */
+struct RequestFeatures {
+    float uri_length = 0;
+
+    /**
+     * @brief Whether the URI path and query were decoded (URIs longer than 1 character)
+     */
+    bool uri_parsed = false;
+    URIDirectoryData directories = { 0, .0, .0 };
+    std::string extension;
+
+    /**
+     * @brief Whether the URI has a query
+     */
+    bool has_query = false;
+    float query_size_log = 0;
+    URIQueryData query = { 0, 0, .0, .0 };
+
+    std::string method;
+    std::string version;
+    std::string header_order;
+    std::string header_values;
+
+    bool has_payload = false;
+    float payload_entropy = 0;
+    float payload_length = 0;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Checks if a mode uses one of the features in [first, last]
+ */
+constexpr bool usesFeatures(const FeatureTypes& features, std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i <= last; i++) {
+        if (features[i] != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Features used by at least one of the modes
+ */
+template<std::size_t N>
+constexpr FeatureTypes featureUnion(const std::array<FeatureTypes, N>& modes) {
+    FeatureTypes features {};
+
+    for (const FeatureTypes& mode: modes) {
+        for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+            if (features[i] == 0) {
+                features[i] = mode[i];
+            }
+        }
+    }
+
+    return features;
+}
+
+/**
+ * @brief Extracts the features used by a mode from an HTTP Request
+ *
+ * Each group of features (URI path, URI query, headers, payload) is only computed if the mode
+ * uses one of them, the code of the groups left out is not compiled in.
+ *
+ * @tparam Features Features to extract, only their presence matters
+ * @param req HTTP Request fields
+ * @return RequestFeatures The extracted features
+ */
+template<FeatureTypes Features>
+RequestFeatures extractFeatures(const HTTPRequest& req) {
+    constexpr bool path = usesFeatures(Features, FEATURE_DIRECTORY_COUNT, FEATURE_EXTENSION);
+    constexpr bool query = usesFeatures(Features, FEATURE_QUERY_SIZE, FEATURE_QUERY_VALUE_SIZE);
+    constexpr bool headers = usesFeatures(Features, FEATURE_HEADER_ORDER, FEATURE_HEADER_VALUES);
+    constexpr bool payload = usesFeatures(Features, FEATURE_PAYLOAD, FEATURE_PAYLOAD_LENGTH);
+
+    // All the features are extracted with the same tables, even if others are loaded meanwhile
+    ConfigGuard config;
+    RequestFeatures features;
+
+    if constexpr (Features[FEATURE_URI_LENGTH] != 0) {
+        features.uri_length = log10length(req.uri);
+    }
+
+    // URI path and query, only decoded for URIs longer than 1 character
+    if constexpr (path || query) {
+        if (req.uri.size() > 1) {
+            URIParts parts = parse_uri(req.uri, query);
+
+            features.uri_parsed = true;
+
+            if constexpr (path) {
+                features.directories = compute_uri_directory_data(parts.path);
+            }
+
+            if constexpr (Features[FEATURE_EXTENSION] != 0) {
+                std::string ext = compute_uri_extention(parts.path);
+
+                if (config->ext.contains(ext)) {
+                    features.extension = std::move(ext);
+                }
+            }
+
+            if constexpr (query) {
+                const URIQueryData& q = parts.query;
+
+                features.query = q;
+                features.has_query =
+                q.size != 0 || q.count != 0 || q.avg_size != .0 || q.avg_size_log != .0;
+                features.query_size_log = log10f(static_cast<float>(q.size));
+            }
+        }
+    }
+
+    if constexpr (Features[FEATURE_METHOD] != 0) {
+        features.method = method_fingerprint(req.method);
+    }
+
+    if constexpr (Features[FEATURE_VERSION] != 0) {
+        features.version = version_fingerprint(req.version);
+    }
+
+    if constexpr (headers) {
+        std::vector<HeaderView> views;
+        views.reserve(req.headers.size());
+
+        for (const std::string& header: req.headers) {
+            views.emplace_back(splitHeaderLine(header));
+        }
+
+        if constexpr (Features[FEATURE_HEADER_ORDER] != 0 && Features[FEATURE_HEADER_VALUES] != 0) {
+            // Both fields: goes through the header block cache
+            std::string encoded = encodeHeaders(views);
+            std::size_t separator = encoded.find('|');
+
+            features.header_order = encoded.substr(0, separator);
+            features.header_values = encoded.substr(separator + 1);
+        } else if constexpr (Features[FEATURE_HEADER_ORDER] != 0) {
+            features.header_order = encodeHeaderOrder(views);
+        } else {
+            features.header_values = encodeHeaderValues(views);
+        }
+    }
+
+    if constexpr (payload) {
+        features.has_payload = !req.payload.empty();
+
+        if constexpr (Features[FEATURE_PAYLOAD_ENTROPY] != 0) {
+            if (features.has_payload) {
+                features.payload_entropy = entropy(req.payload);
+            }
+        }
+
+        features.payload_length = log10length(static_cast<std::uint64_t>(req.payload.size()));
+    }
+
+    return features;
+}
+
+/**
+ * @brief Forges the fingerprint of a mode from the extracted features
+ *
+ * The features used by the mode are given in order, separated by "|". Float features of the 'i'
+ * type are rounded to an integer, the other ones keep the formatting of the full fingerprint.
+ *
+ * @param features Features extracted for this mode (or for a superset of it)
+ * @param mode Type of each feature used by the mode, 0 for the features left out
+ * @return std::string The fingerprint of the mode
+ */
+std::string formatFeatures(const RequestFeatures& features, const FeatureTypes& mode);
+
+/**
+ * @brief Computes the fingerprint of an HTTP Request restricted to the features of a mode
+ *
+ * Only the features of the mode are computed, see extractFeatures().
+ *
+ * @code
+ * std::string fp = fingerprint<FEATURESET[2]>(req);
+ *
+ * // Custom mode, without the URI extension nor the payload
+ * constexpr FeatureTypes LIGHT = { 'f', 'i', 'f', 0, 'f', 'i', 'f', 's', 's', 's', 's', 0, 0, 0 };
+ * std::string light = fingerprint<LIGHT>(req);
+ * @endcode
+ *
+ * @tparam Features Type of each feature used by the mode, 0 for the features left out
+ * @param req HTTP Request fields
+ * @return std::string The computed fingerprint, fingerprint<FULL_FEATURES>() is the same as
+ * fingerprint()
+ */
+template<FeatureTypes Features>
+std::string fingerprint(const HTTPRequest& req) {
+    return formatFeatures(extractFeatures<Features>(req), Features);
+}
+
+/**
+ * @brief Computes the fingerprint of an HTTP Request restricted to the features of a FEATURESET
+ * mode
+ *
+ * @tparam Mode Index of the mode in FEATURESET
+ * @param req HTTP Request fields
+ * @return std::string The computed fingerprint
+ */
+template<std::size_t Mode>
+std::string fingerprint(const HTTPRequest& req) {
+    static_assert(Mode < FEATURESET.size(), "Unknown FEATURESET mode");
+
+    return fingerprint<FEATURESET[Mode]>(req);
+}
+
+/**
+ * @brief Computes the fingerprints of an HTTP Request for several modes at once
+ *
+ * The features used by any of the modes are extracted once, each extra mode only costs its
+ * formatting.
+ *
+ * @code
+ * constexpr FeatureTypes COARSE = { 0, 'i', 0, 's', 0, 0, 0, 's', 's', 's', 0, 0, 0, 0 };
+ * auto [index, stored] = fingerprints<COARSE, FULL_FEATURES>(req);
+ * @endcode
+ *
+ * @tparam Modes Modes to compute
+ * @param req HTTP Request fields
+ * @return std::array<std::string, N> The fingerprint of each mode, same as fingerprint<Mode>()
+ */
+template<FeatureTypes... Modes>
+std::array<std::string, sizeof...(Modes)> fingerprints(const HTTPRequest& req) {
+    constexpr std::array<FeatureTypes, sizeof...(Modes)> modes = { Modes... };
+
+    RequestFeatures features = extractFeatures<featureUnion(modes)>(req);
+
+    return { formatFeatures(features, Modes)... };
+}
+
+/**
+ * @brief Computes the fingerprints of an HTTP Request for several FEATURESET modes at once
+ *
+ * @tparam Modes Indexes of the modes in FEATURESET
+ * @param req HTTP Request fields
+ * @return std::array<std::string, N> The fingerprint of each mode, same as fingerprint<Mode>()
+ */
+template<std::size_t... Modes>
+std::array<std::string, sizeof...(Modes)> fingerprints(const HTTPRequest& req) {
+    static_assert(((Modes < FEATURESET.size()) && ...), "Unknown FEATURESET mode");
+
+    return fingerprints<FEATURESET[Modes]...>(req);
+}
+
+#endif // FINGER_MODES_HPP
@@ -0,0 +1,331 @@
+/**
+ * @file payload.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the incremental payload fingerprinting
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_PAYLOAD_HPP
+#define FINGER_PAYLOAD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <finger/fingerprint.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Settings of the sampled entropy estimation used for large payloads
+ *
+ * Payloads larger than the threshold get their entropy estimated from sample_size bytes, taken as
+ * blocks of block_size contiguous bytes: the payload is cut in as many equal strata as there are
+ * blocks and one block is taken in each stratum at a position drawn from the seed. The same
+ * payload and settings always give the same result.
+ *
+ * Error bound: the estimate is biased low by at most (K - 1) / (2·m·ln 2) bits for K distinct byte
+ * values and m sampled bytes, i.e. below 0.003 bit with the default 64 KiB sample. Its standard
+ * error for content without long range structure is at most of the order of 8 / sqrt(m) bits
+ * (0.03 bit for 64 KiB). Once rounded to 1 decimal, the estimate is the exact entropy or one tenth
+ * away from it when the exact value lies near a rounding boundary. Bodies whose content changes
+ * along the payload (e.g. text parts followed by binary data) have a larger error when few blocks
+ * are taken, lower block_size to take more of them.
+ */
+struct EntropySampling {
+    /**
+     * @brief Payloads up to this size (in bytes) are not sampled
+     */
+    std::uint64_t threshold = 1024 * 1024; // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Number of bytes sampled, at least 1
+     */
+    std::uint64_t sample_size = 64 * 1024; // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Number of contiguous bytes per sampled block
+     */
+    std::uint64_t block_size = 256; // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Seed of the block positions
+     */
+    std::uint64_t seed = 0;
+};
+
+/**
+ * @brief Computes the payload fingerprint of a body received in chunks
+ *
+ * Only the occurrences of each byte value and the total length are kept, the memory used does not
+ * depend on the size of the body.
+ *
+ * @code
+ * PayloadAccumulator acc;
+ *
+ * for (std::string_view chunk: chunks) {
+ *     acc.update(chunk);
+ * }
+ *
+ * std::string fp = acc.finish(); // same as payload_fingerprint(whole body)
+ * @endcode
+ */
+class PayloadAccumulator {
+  public:
+    /**
+     * @brief Feeds the next chunk of the body
+     *
+     * @param chunk Chunk of the body
+     */
+    void update(std::string_view chunk);
+
+    /**
+     * @brief Feeds the next chunk of a binary body
+     *
+     * @param chunk Chunk of the body
+     */
+    void update(std::span<const std::byte> chunk);
+
+    /**
+     * @brief Computes the payload fingerprint of the bytes fed so far
+     *
+     * @return std::string The computed payload fingerprint, same as payload_fingerprint()
+     */
+    std::string finish() const;
+
+    /**
+     * @brief Forgets the bytes fed so far, to reuse the accumulator for another body
+     */
+    void reset();
+
+    /**
+     * @brief Number of bytes fed so far
+     */
+    std::uint64_t size() const { return _size; }
+
+    /**
+     * @brief Occurrences of each byte value fed so far
+     */
+    const ByteHistogram& histogram() const { return _counts; }
+
+  private:
+    ByteHistogram _counts {};
+    std::uint64_t _size = 0;
+};
+
+/**
+ * @brief Decodes a body sent with "Transfer-Encoding: chunked" and feeds the decoded bytes to a
+ * PayloadAccumulator
+ *
+ * The body can be given in pieces of any size, cut anywhere. Chunk data is passed to the
+ * accumulator straight from the given buffers, only the chunk-size lines and the CRLFs are parsed
+ * byte per byte. Chunk extensions and trailer fields are skipped, bare LF line endings are
+ * accepted.
+ *
+ * @code
+ * PayloadAccumulator acc;
+ * ChunkedDecoder decoder(acc);
+ *
+ * for (std::string_view piece: pieces) {
+ *     decoder.update(piece);
+ * }
+ *
+ * if (decoder.done()) {
+ *     std::string fp = acc.finish(); // same as payload_fingerprint(decoded body)
+ * }
+ * @endcode
+ */
+class ChunkedDecoder {
+  public:
+    /**
+     * @param sink Accumulator fed with the decoded bytes, must outlive the decoder
+     */
+    explicit ChunkedDecoder(PayloadAccumulator& sink) : _sink(sink) { }
+
+    /**
+     * @brief Decodes the next piece of the chunked body
+     *
+     * @param data Next piece of the chunked body
+     * @return std::size_t Number of bytes consumed, less than the size of data only when the end of
+     * the body is reached (the remaining bytes belong to the next message)
+     * @throw std::invalid_argument If the body is not valid chunked encoding
+     */
+    std::size_t update(std::string_view data);
+
+    /**
+     * @brief Decodes the next piece of a chunked binary body, see update(std::string_view)
+     */
+    std::size_t update(std::span<const std::byte> data);
+
+    /**
+     * @brief Checks if the last chunk and the trailer section have been decoded
+     */
+    bool done() const { return _state == State::Done; }
+
+    /**
+     * @brief Gets ready to decode another body, the accumulator is left untouched
+     */
+    void reset();
+
+  private:
+    enum class State { Size, Extension, SizeLF, Data, DataCR, DataLF, Trailer, TrailerLine, Done };
+
+    PayloadAccumulator& _sink;
+    State _state = State::Size;
+    std::uint64_t _remaining = 0;
+    bool _digits = false;
+
+    /**
+     * @brief Handles the end of a chunk-size line
+     */
+    void endSizeLine();
+};
+
+/**
+ * @brief Read-only memory mapping of a whole file, used to fingerprint bodies spooled to disk
+ * without reading them into memory
+ *
+ * Pages are loaded by the kernel on access and can be dropped under memory pressure, so the
+ * resident memory does not grow with the size of the file.
+ */
+class MappedFile {
+  public:
+    /**
+     * @param path Path of the file to map
+     * @throw std::system_error If the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    /**
+     * @brief Content of the file
+     */
+    std::span<const std::byte> bytes() const { return { _data, _size }; }
+
+    std::size_t size() const { return _size; }
+
+  private:
+    const std::byte* _data = nullptr;
+    std::size_t _size = 0;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Views a binary payload as a string of bytes, without copying it
+ *
+ * @param bytes Binary payload
+ * @return std::string_view View over the same bytes
+ */
+inline std::string_view bytesView(std::span<const std::byte> bytes) {
+    return { reinterpret_cast<const char*>(bytes.data()), bytes.size() }; // NOLINT
+}
+
+/**
+ * @brief Computes the fingerprint from a binary payload
+ *
+ * @param payload Full payload
+ * @return std::string The computed payload fingerprint, same as payload_fingerprint() on the same
+ * bytes held by a string
+ */
+std::string payload_fingerprint(std::span<const std::byte> payload);
+
+/**
+ * @brief Computes the fingerprint from a binary payload, estimating the entropy of large payloads
+ * from a sample of their bytes
+ *
+ * @param payload Full payload
+ * @param sampling Sampling settings
+ * @return std::string The computed payload fingerprint
+ * @throw std::invalid_argument If sampling.sample_size is 0
+ */
+std::string payload_fingerprint(std::span<const std::byte> payload,
+                                const EntropySampling& sampling);
+
+/**
+ * @brief Computes the fingerprint from a payload spooled to disk, the file is memory-mapped
+ * instead of being read into memory
+ *
+ * @param path Path of the file holding the payload
+ * @return std::string The computed payload fingerprint, same as payload_fingerprint() on the bytes
+ * of the file
+ * @throw std::system_error If the file cannot be opened or mapped
+ */
+std::string file_payload_fingerprint(const std::string& path);
+
+/**
+ * @brief Computes the fingerprint from a payload spooled to disk, estimating the entropy of large
+ * files from a sample of their bytes
+ *
+ * @param path Path of the file holding the payload
+ * @param sampling Sampling settings
+ * @return std::string The computed payload fingerprint
+ * @throw std::system_error If the file cannot be opened or mapped
+ * @throw std::invalid_argument If sampling.sample_size is 0
+ */
+std::string file_payload_fingerprint(const std::string& path, const EntropySampling& sampling);
+
+/**
+ * @brief Computes the fingerprint from the payload, estimating the entropy of large payloads from
+ * a sample of their bytes (the length stays exact)
+ *
+ * @param payload Full payload
+ * @param sampling Sampling settings
+ * @return std::string The computed payload fingerprint
+ * @throw std::invalid_argument If sampling.sample_size is 0
+ */
+std::string payload_fingerprint(std::string_view payload, const EntropySampling& sampling);
+
+/**
+ * @brief Computes the entropy of a payload, estimated from a sample of its bytes when it is larger
+ * than the sampling threshold
+ *
+ * @param payload Full payload
+ * @param sampling Sampling settings
+ * @return float The entropy rounded to 1 decimal
+ * @throw std::invalid_argument If sampling.sample_size is 0
+ */
+float sampledEntropy(std::string_view payload, const EntropySampling& sampling);
+
+/**
+ * @brief Computes the payload fingerprint of a complete body sent with chunked transfer-encoding
+ *
+ * Same as payload_fingerprint() on the decoded body, without building it. A body made of a single
+ * chunk is hashed in place without going through the decoder.
+ *
+ * @param body Chunked body, as received
+ * @return std::string The computed payload fingerprint
+ * @throw std::invalid_argument If the body is not valid or complete chunked encoding
+ */
+std::string chunked_payload_fingerprint(std::string_view body);
+
+/**
+ * @brief Computes the payload fingerprint of a complete binary body sent with chunked
+ * transfer-encoding, see chunked_payload_fingerprint(std::string_view)
+ */
+std::string chunked_payload_fingerprint(std::span<const std::byte> body);
+
+/**
+ * @brief Forges the payload fingerprint from its fields
+ *
+ * @param entropy Entropy of the payload, rounded to 1 decimal
+ * @param length Length of the payload
+ * @return std::string The payload fingerprint ("||" for an empty payload)
+ */
+std::string formatPayloadFingerprint(float entropy, std::uint64_t length);
+
+#endif // FINGER_PAYLOAD_HPP
@@ -0,0 +1,142 @@
+/**
+ * @file simhash.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the SimHash signatures of fingerprints and of their Hamming search index
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_SIMHASH_HPP
+#define FINGER_SIMHASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <finger/configs.hpp>
+#include <finger/distance.hpp>
+#include <string_view>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Signature of a SimHashIndex close to a query
+ */
+struct HammingMatch {
+    std::size_t row;
+    int distance;
+};
+
+/**
+ * @brief Multi-index hashing table of SimHash signatures, finding all the signatures within a
+ * Hamming distance of a query (Norouzi et al.)
+ *
+ * The 64 bits are split in m blocks: two signatures at most r bits apart have a block at most
+ * r / m bits apart. Each block indexes the signatures sorted by the value of the block, with a
+ * directory on its high bits, and a query looks up every value within r / m bits of its own blocks.
+ * Blocks of about log2(n) bits keep both the lookups and the candidates few, only the candidates
+ * are compared to the query.
+ *
+ * The index takes 8 bytes per signature, plus for each block 4 bytes per signature for its sorted
+ * rows and at most as much for its directory (64 / log2(n) blocks, at most k + 1).
+ *
+ * @code
+ * std::vector<std::uint64_t> signatures;
+ *
+ * for (const std::string& fp: references) {
+ *     signatures.push_back(simhash(Fingerprint(fp, FULL_FEATURES)));
+ * }
+ *
+ * SimHashIndex index(std::move(signatures), 3);
+ * std::vector<HammingMatch> close = index.within(simhash(Fingerprint(query, FULL_FEATURES)));
+ * @endcode
+ */
+class SimHashIndex {
+  public:
+    /**
+     * @brief Builds the index
+     *
+     * @param signatures Signatures, their position is their row
+     * @param k Largest Hamming distance searched, from 0 to 63
+     * @throw std::invalid_argument If k is out of bounds
+     */
+    SimHashIndex(std::vector<std::uint64_t> signatures, int k);
+
+    /**
+     * @brief Number of signatures
+     */
+    std::size_t size() const { return _signatures.size(); }
+
+    /**
+     * @brief Largest Hamming distance searched
+     */
+    int k() const { return _k; }
+
+    /**
+     * @brief Signature of a row
+     */
+    std::uint64_t signature(std::size_t row) const { return _signatures[row]; }
+
+    /**
+     * @brief Finds the signatures within a Hamming distance of the query
+     *
+     * @param query Signature
+     * @param radius Largest Hamming distance, at most k(), k() if negative
+     * @return std::vector<HammingMatch> Rows at most at radius bits from the query, by increasing
+     * distance, then row
+     * @throw std::invalid_argument If radius is greater than k()
+     */
+    std::vector<HammingMatch> within(std::uint64_t query, int radius = -1) const;
+
+  private:
+    /**
+     * @brief Rows sorted by the value of a block of bits, with a directory on the high bits
+     */
+    struct Block {
+        unsigned shift;
+        unsigned width;
+        unsigned directoryBits;
+        std::vector<std::uint32_t> rows;
+        std::vector<std::uint32_t> directory;
+
+        std::uint64_t value(std::uint64_t signature) const;
+    };
+
+    std::vector<std::uint64_t> _signatures;
+    int _k;
+    std::vector<Block> _blocks;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Computes the 64 bits SimHash (Charikar) of a fingerprint
+ *
+ * The tokens are the header names of the header order and their successive pairs, the encoded
+ * header values, the URI features (numbers rounded to the unit) and the method and version. Each
+ * bit of the signature is the majority of this bit over the hashes of the tokens: fingerprints
+ * sharing most of their tokens get signatures a few bits apart. Features left out of the mode or
+ * empty give no token.
+ *
+ * @param fp Fingerprint
+ * @return std::uint64_t The signature, 0 if the fingerprint has no token
+ */
+std::uint64_t simhash(const Fingerprint& fp);
+
+/**
+ * @brief Computes the SimHash of a fingerprint of a mode, parsing it first
+ *
+ * @param fp Fingerprint
+ * @param mode Features of the fingerprint
+ * @return std::uint64_t The signature
+ * @throw std::invalid_argument If the number of fields does not match the mode
+ */
+std::uint64_t simhash(std::string_view fp, const FeatureTypes& mode);
+
+#endif // FINGER_SIMHASH_HPP
@@ -0,0 +1,151 @@
+/**
+ * @file store.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the column-wise store of reference fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_STORE_HPP
+#define FINGER_STORE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <finger/configs.hpp>
+#include <finger/distance.hpp>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Row of a FingerprintTable close to a query
+ */
+struct TableMatch {
+    std::size_t row;
+    double distance;
+};
+
+/**
+ * @brief Reference fingerprints stored column-wise, to compare a query against all of them
+ *
+ * Each feature of the mode is a column:
+ * - numeric features as floats, empty and non numeric values being boxed in NaNs
+ * - string features as interned IDs
+ * - header order and header values as 64 bits masks of their hashed tokens, the tokens themselves
+ *   being kept in pools for the exact comparison
+ *
+ * The numeric and string columns are compared with AVX-512 or AVX2 when the CPU supports it, the
+ * header masks give a lower bound of the header distances which skips the exact comparison of the
+ * rows too far from the query. Distances are the same as distance(), up to the float precision.
+ *
+ * @code
+ * FingerprintTable table(FEATURESET[2]);
+ *
+ * for (const std::string& fp: references) {
+ *     table.add(Fingerprint(fp, FEATURESET[2]));
+ * }
+ *
+ * std::vector<TableMatch> close = table.within(Fingerprint(query, FEATURESET[2]), 0.1);
+ * @endcode
+ */
+class FingerprintTable {
+  public:
+    /**
+     * @param mode Features compared, the fingerprints added and the queries must hold them
+     */
+    explicit FingerprintTable(const FeatureTypes& mode);
+
+    /**
+     * @brief Features compared
+     */
+    const FeatureTypes& mode() const { return _mode; }
+
+    /**
+     * @brief Number of rows
+     */
+    std::size_t size() const { return _rows; }
+
+    /**
+     * @brief Reserves the storage of the columns
+     *
+     * @param rows Expected number of rows
+     */
+    void reserve(std::size_t rows);
+
+    /**
+     * @brief Adds a reference fingerprint
+     *
+     * @param fp Fingerprint, holding the features of the mode
+     * @return std::size_t Row of the fingerprint
+     * @throw std::invalid_argument If a feature of the mode is not in the fingerprint
+     */
+    std::size_t add(const Fingerprint& fp);
+
+    /**
+     * @brief Computes the distance from the query to every row
+     *
+     * @param query Fingerprint, holding the features of the mode
+     * @param out Distance of each row, of size() elements
+     * @throw std::invalid_argument If a feature of the mode is not in the query or out does not
+     * have size() elements
+     */
+    void distances(const Fingerprint& query, std::span<double> out) const;
+
+    /**
+     * @brief Finds the rows within a distance of the query
+     *
+     * @param query Fingerprint, holding the features of the mode
+     * @param threshold Largest distance
+     * @return std::vector<TableMatch> Rows at most at threshold from the query, in row order
+     * @throw std::invalid_argument If a feature of the mode is not in the query
+     */
+    std::vector<TableMatch> within(const Fingerprint& query, double threshold) const;
+
+  private:
+    FeatureTypes _mode;
+    std::size_t _rows = 0;
+
+    std::vector<std::size_t> _numericFeatures;
+    std::vector<std::size_t> _stringFeatures;
+    bool _order;
+    bool _values;
+    std::size_t _count;
+
+    std::vector<std::vector<float>> _numeric;
+    std::vector<std::vector<std::uint32_t>> _strings;
+    std::unordered_map<std::uint32_t, std::uint32_t> _ids;
+
+    std::vector<std::uint64_t> _orderMasks;
+    std::vector<std::uint32_t> _orderOffsets;
+    std::vector<std::uint32_t> _orderTokens;
+
+    std::vector<std::uint64_t> _valuesMasks;
+    std::vector<std::uint32_t> _valuesOffsets;
+    std::vector<std::uint32_t> _valuesTokens;
+
+    /**
+     * @brief Computes the distances of the rows within the threshold, gives them to the callback
+     */
+    template<typename F>
+    void scan(const Fingerprint& query, double threshold, F&& found) const;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Name of the kernel comparing the columns on this CPU
+ *
+ * @return const char* "avx512", "avx2" or "scalar"
+ */
+const char* distance_kernel();
+
+#endif // FINGER_STORE_HPP
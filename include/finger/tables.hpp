@@ -0,0 +1,126 @@
+/**
+ * @file tables.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the configuration tables loadable at run time
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_TABLES_HPP
+#define FINGER_TABLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <finger/frozen.hpp>
+#include <json.hpp>
+#include <string>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Values mapping used for the fingerprint generation, the compiled tables of configs.hpp
+ * unless tables were loaded with config_load()
+ */
+struct ConfigTables {
+    FrozenMapView ae;
+    FrozenMapView conn;
+    FrozenMapView contenc;
+    FrozenMapView cachecont;
+    FrozenMapView te;
+    FrozenMapView acceptchar;
+    FrozenMapView headers;
+    FrozenMapView accept;
+    FrozenMapView content_type;
+    FrozenMapView ext;
+
+    /**
+     * @brief Header names by their shortened name, in the order of headers
+     */
+    FrozenMapView header_codes;
+};
+
+class ConfigSnapshot;
+
+/**
+ * @brief Gives access to the current configuration tables, which stay valid and unchanged for the
+ * lifetime of the guard even if other tables are loaded meanwhile
+ *
+ * Taking a guard never locks: the snapshot in use is published in a hazard slot of the calling
+ * thread, a reload only frees a snapshot once no slot holds it anymore. Guards taken while the
+ * thread already holds one share its snapshot, so that a whole fingerprint is computed with the
+ * same tables.
+ */
+class ConfigGuard {
+  public:
+    ConfigGuard();
+    ~ConfigGuard();
+
+    ConfigGuard(const ConfigGuard&) = delete;
+    ConfigGuard& operator=(const ConfigGuard&) = delete;
+
+    const ConfigTables& operator*() const { return *_tables; }
+    const ConfigTables* operator->() const { return _tables; }
+
+    /**
+     * @brief Generation of the tables, 0 for the compiled tables, increased by each load
+     */
+    std::uint64_t generation() const { return _generation; }
+
+  private:
+    const ConfigTables* _tables;
+    std::uint64_t _generation;
+};
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                       Methods                                        //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Loads configuration tables and publishes them for all threads
+ *
+ * The tables are named as in configs.hpp, "EXT" is an array of extensions and the other ones are
+ * objects mapping a value to its code. A table given replaces the compiled one, the tables not
+ * given keep their compiled values:
+ *
+ * @code
+ * { "ACCEPT": { "text/html": "te/ht", "application/json": "ap/js" }, "EXT": [ "php", "html" ] }
+ * @endcode
+ *
+ * Fingerprints being computed keep the tables they started with, the memoized values are dropped
+ * by each thread on its next use.
+ *
+ * @param tables Tables to load
+ * @throw std::invalid_argument If a table is unknown or malformed, the current tables are kept
+ */
+void config_load(const nlohmann::json& tables);
+
+/**
+ * @brief Loads configuration tables from a JSON file, see config_load()
+ *
+ * @param path Path of the JSON file
+ * @throw std::invalid_argument If the file cannot be read or holds invalid tables, the current
+ * tables are kept
+ */
+void config_load_file(const std::string& path);
+
+/**
+ * @brief Goes back to the compiled tables
+ */
+void config_reset();
+
+/**
+ * @brief Frees the replaced tables that were still used by a thread during the last load
+ *
+ * Loads and resets already free them when possible, this only needs to be called to release them
+ * earlier.
+ *
+ * @return std::size_t Number of replaced tables still in use
+ */
+std::size_t config_reclaim();
+
+#endif // FINGER_TABLES_HPP
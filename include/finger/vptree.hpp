@@ -0,0 +1,133 @@
+/**
+ * @file vptree.hpp
+ * @author Gautier Miquet
+ * @brief Declaration of the vantage-point tree, a metric index of reference fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#ifndef FINGER_VPTREE_HPP
+#define FINGER_VPTREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <finger/configs.hpp>
+#include <finger/distance.hpp>
+#include <finger/store.hpp>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------------------------------------------//
+//                                                                                      //
+//                                   Data Structures                                    //
+//                                                                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Vantage-point tree over reference fingerprints, for exact nearest neighbours and range
+ * queries with distance()
+ *
+ * Each node picks a fingerprint as vantage point and splits the others at the median of their
+ * distance to it: the closer half goes inside, the farther half outside. As distance() is a
+ * metric, the triangle inequality tells which halves may hold matches, a query only compares a
+ * small part of the references when they are clustered, as fingerprints of the same client stacks
+ * are.
+ *
+ * The tree is stored implicitly: the fingerprints are permuted so that every node is a range,
+ * holding its vantage point first, then its inside and outside halves. Only the median distance
+ * of each node is kept besides the fingerprints.
+ *
+ * @code
+ * VPTree tree(references, FEATURESET[2]);
+ *
+ * for (const TableMatch& match: tree.knn(Fingerprint(query, FEATURESET[2]), 5)) {
+ *     std::cout << tree.text(match.row) << " " << match.distance << std::endl;
+ * }
+ * @endcode
+ */
+class VPTree {
+  public:
+    /**
+     * @brief Builds the tree, the fingerprints are parsed and the subtrees built in parallel
+     *
+     * @param fingerprints Reference fingerprints, of the mode
+     * @param mode Features of the fingerprints
+     * @param threads Number of threads used, 0 for one per core
+     * @throw std::invalid_argument If a fingerprint does not match the mode
+     */
+    VPTree(std::vector<std::string> fingerprints, const FeatureTypes& mode,
+           std::size_t threads = 0);
+
+    /**
+     * @brief Features of the fingerprints
+     */
+    const FeatureTypes& mode() const { return _mode; }
+
+    /**
+     * @brief Number of reference fingerprints
+     */
+    std::size_t size() const { return _texts.size(); }
+
+    /**
+     * @brief Reference fingerprint, by its position in the list given to the constructor
+     */
+    const std::string& text(std::size_t index) const { return _texts[index]; }
+
+    /**
+     * @brief Finds the k references closest to the query
+     *
+     * @param query Fingerprint, holding the features of the mode
+     * @param k Number of neighbours
+     * @return std::vector<TableMatch> The min(k, size()) closest references, by increasing
+     * distance, row being their position in the list given to the constructor
+     * @throw std::invalid_argument If a feature of the mode is not in the query
+     */
+    std::vector<TableMatch> knn(const Fingerprint& query, std::size_t k) const;
+
+    /**
+     * @brief Finds the references within a distance of the query
+     *
+     * @param query Fingerprint, holding the features of the mode
+     * @param radius Largest distance
+     * @return std::vector<TableMatch> References at most at radius from the query, by increasing
+     * distance
+     * @throw std::invalid_argument If a feature of the mode is not in the query
+     */
+    std::vector<TableMatch> within(const Fingerprint& query, double radius) const;
+
+    /**
+     * @brief Writes the tree in a binary format, to load it back without building it again
+     *
+     * @param out Binary stream
+     */
+    void save(std::ostream& out) const;
+
+    /**
+     * @brief Reads a tree written by save()
+     *
+     * @param in Binary stream
+     * @return VPTree The tree, as saved
+     * @throw std::invalid_argument If the stream does not hold a valid tree
+     */
+    static VPTree load(std::istream& in);
+
+  private:
+    FeatureTypes _mode;
+    std::vector<std::string> _texts;
+    std::vector<Fingerprint> _fingerprints;
+
+    // Position of each node of the implicit tree in the list of references
+    std::vector<std::uint32_t> _nodes;
+    // Median distance of the node whose vantage point is at this position, unused in leaves
+    std::vector<double> _radius;
+
+    VPTree(const FeatureTypes& mode, std::vector<std::string> texts, std::size_t threads);
+
+    void build(std::size_t lo, std::size_t hi, std::size_t threads);
+
+    template<typename F>
+    void search(const Fingerprint& query, std::size_t lo, std::size_t hi, double& tau,
+                F& found) const;
+};
+
+#endif // FINGER_VPTREE_HPP
@@ -0,0 +1,50 @@
+/**
+ * @file bench.hpp
+ * @author Gautier Miquet
+ * @brief Timing helpers of the benchmarks
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+#ifndef TEST_BENCH_HPP
+#define TEST_BENCH_HPP
+
+#include <chrono>
+
+/**
+ * @brief Runs the function once, returns its time in ms
+ */
+template<typename F>
+double measure(F&& f) {
+    auto begin = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+
+    return elapsed.count();
+}
+
+/**
+ * @brief Runs the function until it took at least the given time, returns the average time of a
+ * run in ns
+ *
+ * @param f Function to run
+ * @param duration Shortest total time of the runs
+ * @return double Average time of a run in ns
+ */
+template<typename F>
+double measure_average(F&& f, std::chrono::nanoseconds duration) {
+    using clock = std::chrono::steady_clock;
+
+    int runs = 0;
+    auto begin = clock::now();
+    std::chrono::nanoseconds elapsed {};
+
+    do {
+        f();
+        runs++;
+        elapsed = clock::now() - begin;
+    } while (elapsed < duration);
+
+    return static_cast<double>(elapsed.count()) / runs;
+}
+
+#endif // TEST_BENCH_HPP
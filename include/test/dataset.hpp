@@ -8,7 +8,9 @@
 #ifndef TEST_DATASET_HPP
 #define TEST_DATASET_HPP
 
+#include <cstddef>
 #include <json.hpp>
+#include <string>
 #include <vector>
 
 /**
@@ -31,4 +33,42 @@ nlohmann::json dataset_use(const std::string& filepath, std::vector<std::string>
  */
 bool dataset_contains(nlohmann::json j, std::vector<std::string> fields);
 
+/**
+ * @brief Get the fingerprints of the full dataset
+ *
+ * @return std::vector<std::string> Fingerprints of the FULL_FEATURES mode, in the dataset order
+ */
+std::vector<std::string> dataset_fingerprints();
+
+/**
+ * @brief Perturbs fingerprints to get clusters of close ones, as the benchmarks use them: their
+ * URI length and directory size are drawn at random, and the first two headers of the header
+ * order of 30% of them are swapped
+ *
+ * @param base Fingerprints of the FULL_FEATURES mode
+ * @param count Number of fingerprints
+ * @param seed Seed of the perturbations
+ * @param shuffled Whether the base fingerprints are drawn at random rather than taken in turn
+ * @return std::vector<std::string> The perturbed fingerprints
+ */
+std::vector<std::string> dataset_perturb(const std::vector<std::string>& base,
+                                         std::size_t count,
+                                         unsigned seed,
+                                         bool shuffled);
+
+/**
+ * @brief Builds reference fingerprints from the full dataset ones, with their URI length and
+ * header order perturbed to get clusters of close fingerprints
+ *
+ * @param count Number of fingerprints
+ * @param seed Seed of the perturbations
+ * @param shuffled Whether the dataset fingerprints are drawn at random rather than taken in turn
+ * @param uri_digits Number of digits of the integer part of the URI lengths
+ * @return std::vector<std::string> Fingerprints of the FULL_FEATURES mode
+ */
+std::vector<std::string> dataset_references(std::size_t count,
+                                            unsigned seed,
+                                            bool shuffled = true,
+                                            unsigned uri_digits = 2);
+
 #endif // TEST_DATASET_HPP
@@ -184,7 +184,7 @@ def get_request(entry):
     delim = "0d0a0d0a" if "0d0a0d0a" in frame_raw else "0d0a"
     payload_raw = frame_raw[frame_raw.find(delim) + len(delim):]
 
-    # If can't read payload, use empty string
+    # If can't read payload, use empty string, the raw bytes are kept in payload_hex
     try:
         payload = bytes.fromhex(payload_raw).decode()
     except Exception:
@@ -193,7 +193,8 @@ def get_request(entry):
     return {
         "raw": http_req_raw,
         "parsed": http_req_parsed,
-        "payload": str(payload)
+        "payload": str(payload),
+        "payload_hex": payload_raw
     }
 
 
@@ -219,6 +220,7 @@ def format_entry_cpp(entry):
         "version": version.replace("HTTP/", ""),
         "headers": req[1:],
         "payload": entry["request"]["payload"],
+        "payload_hex": entry["request"].get("payload_hex", ""),
         "fingerprint": entry["fingerprint"]["fingerprint"]
     }
 
@@ -0,0 +1,166 @@
+/**
+ * @file cache.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the bounded caches used to memoize encoded header values and blocks
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <array>
+#include <atomic>
+#include <bit>
+#include <finger/cache.hpp>
+#include <stdexcept>
+
+//--------------------------------------------------------------------------------------//
+//                                      ValueCache                                      //
+//--------------------------------------------------------------------------------------//
+
+ValueCache::ValueCache(std::size_t capacity) {
+    if (capacity > MAX_CAPACITY) {
+        throw std::invalid_argument("ValueCache: capacity too large");
+    }
+
+    if (capacity == 0) {
+        return;
+    }
+
+    _slots.resize(std::bit_ceil(capacity));
+}
+
+const std::string* ValueCache::find(std::string_view key, std::size_t hash) {
+    if (_slots.empty()) {
+        return nullptr;
+    }
+
+    const Slot& slot = _slots[hash & (_slots.size() - 1)];
+
+    if (slot.used && slot.hash == hash && slot.key == key) {
+        _stats.hits++;
+        return &slot.value;
+    }
+
+    _stats.misses++;
+
+    return nullptr;
+}
+
+const std::string& ValueCache::insert(std::string_view key, std::size_t hash, std::string value) {
+    Slot& slot = _slots[hash & (_slots.size() - 1)];
+
+    slot.used = true;
+    slot.hash = hash;
+    slot.key.assign(key);
+    slot.value = std::move(value);
+
+    return slot.value;
+}
+
+void ValueCache::clear() {
+    for (auto& slot: _slots) {
+        slot = Slot();
+    }
+
+    _stats = { 0, 0 };
+}
+
+//--------------------------------------------------------------------------------------//
+//                                  Per-thread caches                                   //
+//--------------------------------------------------------------------------------------//
+
+namespace {
+
+/**
+ * @brief Capacity requested for the value caches, 0 when memoization is disabled
+ */
+std::atomic<std::size_t> value_capacity { 0 };
+
+/**
+ * @brief Capacity requested for the header block cache, 0 when it is disabled
+ */
+std::atomic<std::size_t> header_capacity { 0 };
+
+/**
+ * @brief Throws if the capacity is too large, before any thread allocates its caches with it
+ */
+std::size_t checkCapacity(std::size_t capacity) {
+    if (capacity > ValueCache::MAX_CAPACITY) {
+        throw std::invalid_argument("ValueCache: capacity too large");
+    }
+
+    return capacity;
+}
+
+/**
+ * @brief Caches of the calling thread, all sized from the capacity requested for every thread
+ */
+template<std::size_t N>
+struct ThreadCaches {
+    std::size_t capacity = 0;
+    std::uint64_t generation = 0;
+    std::array<ValueCache, N> caches;
+
+    /**
+     * @brief Get the cache at the given index, (re)allocates the caches when the requested
+     * capacity changed and clears them when the configuration tables changed
+     *
+     * @return ValueCache* The cache, nullptr if the requested capacity is 0
+     */
+    ValueCache* get(std::size_t requested, std::size_t index, std::uint64_t tables) {
+        if (requested != capacity) {
+            for (auto& cache: caches) {
+                cache = ValueCache(requested);
+            }
+
+            capacity = requested;
+        } else if (tables != generation) {
+            for (auto& cache: caches) {
+                cache.clear();
+            }
+        }
+
+        generation = tables;
+
+        if (capacity == 0) {
+            return nullptr;
+        }
+
+        return &caches[index];
+    }
+};
+
+thread_local ThreadCaches<static_cast<std::size_t>(CachedHeader::Count)> value_caches;
+thread_local ThreadCaches<1> header_caches;
+
+} // namespace
+
+// Header values
+
+void value_cache_enable(std::size_t capacity) {
+    value_capacity.store(checkCapacity(capacity), std::memory_order_relaxed);
+}
+
+void value_cache_disable() { value_capacity.store(0, std::memory_order_relaxed); }
+
+ValueCache* value_cache(CachedHeader header, std::uint64_t generation) {
+    return value_caches.get(value_capacity.load(std::memory_order_relaxed),
+                            static_cast<std::size_t>(header),
+                            generation);
+}
+
+CacheStats value_cache_stats(CachedHeader header) {
+    return value_caches.caches[static_cast<std::size_t>(header)].stats();
+}
+
+// Header blocks
+
+void header_cache_enable(std::size_t capacity) {
+    header_capacity.store(checkCapacity(capacity), std::memory_order_relaxed);
+}
+
+void header_cache_disable() { header_capacity.store(0, std::memory_order_relaxed); }
+
+ValueCache* header_cache(std::uint64_t generation) {
+    return header_caches.get(header_capacity.load(std::memory_order_relaxed), 0, generation);
+}
+
+CacheStats header_cache_stats() { return header_caches.caches[0].stats(); }
@@ -0,0 +1,395 @@
+/**
+ * @file distance.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the distance between fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <finger/distance.hpp>
+#include <finger/fingerprint.hpp>
+#include <stdexcept>
+
+/**
+ * @brief Longest sequence compared with the bit-parallel edit distance, one bit per token
+ */
+static constexpr std::size_t MAX_PATTERN_TOKENS = 64;
+
+//--------------------------------------------------------------------------------------//
+//                                       Parsing                                        //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Splits a list into hashed tokens
+ */
+static std::vector<std::uint32_t> hashTokens(std::string_view list, char separator) {
+    std::vector<std::uint32_t> tokens;
+
+    while (!list.empty()) {
+        std::size_t end = std::min(list.find(separator), list.size());
+
+        tokens.push_back(fnv1a_32_update(FNV1A_32_OFFSET_BASIS, list.substr(0, end)));
+        list.remove_prefix(std::min(end + 1, list.size()));
+    }
+
+    return tokens;
+}
+
+/**
+ * @brief Splits the header values into hashed "name:value" tokens, sorted and without duplicates
+ *
+ * Values may hold a '/' themselves ("ac:te/ht"), so a '/' only separates two tokens when the next
+ * part holds the ':' of a header name.
+ */
+static std::vector<std::uint32_t> hashValues(std::string_view values) {
+    std::vector<std::uint32_t> tokens;
+    std::size_t start = 0;
+
+    while (start < values.size()) {
+        std::size_t end = values.find('/', start);
+
+        while (end != std::string_view::npos) {
+            std::size_t next = values.find('/', end + 1);
+
+            // Up to the end of the values when next is npos
+            if (values.substr(end + 1, next - end - 1).find(':') != std::string_view::npos) {
+                break;
+            }
+
+            end = next;
+        }
+
+        end = std::min(end, values.size());
+        tokens.push_back(fnv1a_32_update(FNV1A_32_OFFSET_BASIS, values.substr(start, end - start)));
+        start = end + 1;
+    }
+
+    std::sort(tokens.begin(), tokens.end());
+    tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+
+    return tokens;
+}
+
+/**
+ * @brief Parses a feature, as a number for the 'i' and 'f' types
+ */
+static FingerprintField parseField(std::string_view text, char type) {
+    FingerprintField field;
+
+    field.empty = text.empty();
+    field.hash = fnv1a_32_update(FNV1A_32_OFFSET_BASIS, text);
+
+    if (type != 's' && !text.empty()) {
+        const char* end = text.data() + text.size();
+        auto [ptr, ec] = std::from_chars(text.data(), end, field.number);
+
+        field.numeric = ec == std::errc() && ptr == end;
+    }
+
+    return field;
+}
+
+Fingerprint::Fingerprint(std::string_view text, const FeatureTypes& mode) : _mode(mode) {
+    bool first = true;
+
+    for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+        if (mode[i] == 0) {
+            continue;
+        }
+
+        if (!first) {
+            if (text.empty() || text.front() != '|') {
+                throw std::invalid_argument("Fingerprint: fewer fields than the mode features");
+            }
+
+            text.remove_prefix(1);
+        }
+
+        first = false;
+
+        std::size_t end = std::min(text.find('|'), text.size());
+        std::string_view value = text.substr(0, end);
+
+        _fields[i] = parseField(value, mode[i]);
+
+        if (i == FEATURE_HEADER_ORDER) {
+            _order = hashTokens(value, ',');
+            _masks = orderMasks(value);
+        } else if (i == FEATURE_HEADER_VALUES) {
+            _values = hashValues(value);
+            _valueBits = valuesBits(value);
+        }
+
+        text.remove_prefix(end);
+    }
+
+    if (!text.empty()) {
+        throw std::invalid_argument("Fingerprint: more fields than the mode features");
+    }
+}
+
+//--------------------------------------------------------------------------------------//
+//                                     Comparators                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Symbols of a sequence of up to 64 tokens, mapping each token to the mask of its positions
+ *
+ * A small open addressing table, sized for the sequence, as tokens are arbitrary 32 bits hashes.
+ */
+class TokenPositions {
+  public:
+    explicit TokenPositions(std::span<const std::uint32_t> tokens) {
+        while (_size < 2 * tokens.size()) {
+            _size *= 2;
+            _shift--;
+        }
+
+        std::fill(_keys.begin(), _keys.begin() + _size, 0);
+        std::fill(_masks.begin(), _masks.begin() + _size, 0);
+
+        for (std::size_t i = 0; i < tokens.size(); i++) {
+            std::size_t slot = find(tokens[i]);
+
+            _keys[slot] = std::uint64_t(tokens[i]) + 1;
+            _masks[slot] |= std::uint64_t(1) << i;
+        }
+    }
+
+    /**
+     * @brief Mask of the positions of the token, 0 if absent
+     */
+    std::uint64_t positions(std::uint32_t token) const {
+        std::size_t slot = find(token);
+
+        return _keys[slot] != 0 ? _masks[slot] : 0;
+    }
+
+  private:
+    static constexpr std::size_t MAX_SLOTS = 128;
+    static constexpr std::uint32_t MIX = 0x9E3779B9U; // NOLINT(readability-magic-numbers)
+
+    // Keys are stored as token + 1, 0 marks a free slot
+    // Only the slots in use are initialized
+    std::array<std::uint64_t, MAX_SLOTS> _keys;
+    std::array<std::uint64_t, MAX_SLOTS> _masks;
+    std::size_t _size = 8;   // NOLINT(readability-magic-numbers)
+    unsigned _shift = 32 - 3; // NOLINT(readability-magic-numbers)
+
+    std::size_t find(std::uint32_t token) const {
+        std::size_t slot = (token * MIX) >> _shift;
+
+        while (_keys[slot] != 0 && _keys[slot] != std::uint64_t(token) + 1) {
+            slot = (slot + 1) & (_size - 1);
+        }
+
+        return slot;
+    }
+};
+
+/**
+ * @brief Edit distance of a pattern of 1 to 64 tokens against a sequence, with Hyyrö's variant of
+ * Myers' bit-parallel algorithm: the vertical deltas of a whole column of the dynamic programming
+ * matrix are updated at once
+ */
+static std::size_t bitParallelDistance(std::span<const std::uint32_t> pattern,
+                                       std::span<const std::uint32_t> text,
+                                       std::size_t max) {
+    TokenPositions peq(pattern);
+
+    std::uint64_t last = std::uint64_t(1) << (pattern.size() - 1);
+    std::uint64_t pv = ~std::uint64_t(0);
+    std::uint64_t mv = 0;
+    std::size_t score = pattern.size();
+
+    for (std::size_t j = 0; j < text.size(); j++) {
+        std::uint64_t eq = peq.positions(text[j]);
+        std::uint64_t xv = eq | mv;
+        std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        std::uint64_t ph = mv | ~(xh | pv);
+        std::uint64_t mh = pv & xh;
+
+        if ((ph & last) != 0) {
+            score++;
+        } else if ((mh & last) != 0) {
+            score--;
+        }
+
+        // Each remaining token lowers the distance by 1 at most
+        if (score > max && score - max > text.size() - j - 1) {
+            return max + 1;
+        }
+
+        // The first row of the matrix grows by 1 at each token
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+
+    return score;
+}
+
+/**
+ * @brief Edit distance with a row of the dynamic programming matrix, for sequences longer than 64
+ * tokens
+ */
+static std::size_t rowDistance(std::span<const std::uint32_t> a,
+                               std::span<const std::uint32_t> b,
+                               std::size_t max) {
+    std::vector<std::size_t> row(b.size() + 1);
+
+    for (std::size_t j = 0; j <= b.size(); j++) {
+        row[j] = j;
+    }
+
+    for (std::size_t i = 1; i <= a.size(); i++) {
+        std::size_t diagonal = row[0];
+        std::size_t lowest = row[0] = i;
+
+        for (std::size_t j = 1; j <= b.size(); j++) {
+            std::size_t above = row[j];
+            row[j] = std::min({ row[j] + 1, row[j - 1] + 1,
+                                diagonal + (a[i - 1] == b[j - 1] ? 0 : 1) });
+            diagonal = above;
+            lowest = std::min(lowest, row[j]);
+        }
+
+        // The distance never goes below the lowest value of a row
+        if (lowest > max) {
+            return max + 1;
+        }
+    }
+
+    return row[b.size()] > max ? max + 1 : row[b.size()];
+}
+
+std::size_t editDistance(std::span<const std::uint32_t> a,
+                         std::span<const std::uint32_t> b,
+                         std::size_t max) {
+    if (a.size() > b.size()) {
+        std::swap(a, b);
+    }
+
+    if (b.size() - a.size() > max) {
+        return max + 1;
+    }
+
+    if (a.empty()) {
+        return b.size();
+    }
+
+    if (a.size() <= MAX_PATTERN_TOKENS) {
+        return bitParallelDistance(a, b, max);
+    }
+
+    return rowDistance(a, b, max);
+}
+
+double jaccardDistance(std::span<const std::uint32_t> a, std::span<const std::uint32_t> b) {
+    std::size_t common = 0;
+    auto i = a.begin();
+    auto j = b.begin();
+
+    while (i != a.end() && j != b.end()) {
+        if (*i < *j) {
+            i++;
+        } else if (*j < *i) {
+            j++;
+        } else {
+            common++;
+            i++;
+            j++;
+        }
+    }
+
+    std::size_t total = a.size() + b.size() - common;
+
+    return total == 0 ? 0 : 1 - static_cast<double>(common) / static_cast<double>(total);
+}
+
+/**
+ * @brief Normalized absolute difference of two numbers, capped to 1
+ */
+static double numberDistance(double a, double b) {
+    if (a == b) {
+        return 0;
+    }
+
+    // Infinite (log10 of a 0 size) or not a number
+    if (!std::isfinite(a) || !std::isfinite(b)) {
+        return 1;
+    }
+
+    double scale = std::max({ std::fabs(a), std::fabs(b), 1. });
+
+    return std::min(std::fabs(a - b) / scale, 1.);
+}
+
+/**
+ * @brief Distance between two features of a given type
+ */
+static double featureDistance(const Fingerprint& a, const Fingerprint& b, std::size_t feature,
+                              char type) {
+    const FingerprintField& x = a.field(feature);
+    const FingerprintField& y = b.field(feature);
+
+    if (x.empty || y.empty) {
+        return x.empty == y.empty ? 0 : 1;
+    }
+
+    if (feature == FEATURE_HEADER_ORDER) {
+        return normalizedEditDistance(editDistance(a.headerOrder(), b.headerOrder()),
+                                      a.headerOrder().size(),
+                                      b.headerOrder().size());
+    }
+
+    if (feature == FEATURE_HEADER_VALUES) {
+        return jaccardDistance(a.headerValues(), b.headerValues());
+    }
+
+    if (type != 's' && x.numeric && y.numeric) {
+        return numberDistance(x.number, y.number);
+    }
+
+    return x.hash == y.hash ? 0 : 1;
+}
+
+//--------------------------------------------------------------------------------------//
+//                                       Distance                                       //
+//--------------------------------------------------------------------------------------//
+
+double distance(const Fingerprint& a, const Fingerprint& b, const FeatureTypes& mode) {
+    double total = 0;
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+        if (mode[i] == 0) {
+            continue;
+        }
+
+        if (a.mode()[i] == 0 || b.mode()[i] == 0) {
+            throw std::invalid_argument("distance: feature not in both fingerprints");
+        }
+
+        total += featureDistance(a, b, i, mode[i]);
+        count++;
+    }
+
+    return count == 0 ? 0 : total / static_cast<double>(count);
+}
+
+double distance(const Fingerprint& a, const Fingerprint& b) {
+    if (a.mode() != b.mode()) {
+        throw std::invalid_argument("distance: fingerprints of different modes");
+    }
+
+    return distance(a, b, a.mode());
+}
+
+double distance(std::string_view a, std::string_view b, const FeatureTypes& mode) {
+    return distance(Fingerprint(a, mode), Fingerprint(b, mode), mode);
+}
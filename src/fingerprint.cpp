@@ -1,604 +1,1071 @@
-/**
- * @file fingerprint.cpp
- * @author Gautier Miquet
- * @brief Implementation of HTTP Fingerprinting methods
- * @version 1.0.0
- * @date 2022-03-03
- */
-#include <boost/algorithm/string.hpp>
-#include <filesystem>
-#include <finger/fingerprint.hpp>
-#include <iomanip>
-#include <map>
-
-//--------------------------------------------------------------------------------------//
-//                               Fingerprint Computation                                //
-//--------------------------------------------------------------------------------------//
-
-std::string fingerprint(const HTTPRequest& req) {
-    std::stringstream fingerprint;
-
-    fingerprint << uri_fingerprint(req.uri) << "|";
-    fingerprint << method_fingerprint(req.method) << "|";
-    fingerprint << version_fingerprint(req.version) << "|";
-    fingerprint << header_fingerprint(req.headers) << "|";
-    fingerprint << payload_fingerprint(req.payload);
-
-    return fingerprint.str();
-}
-
-std::string uri_fingerprint(const std::string& uri) {
-    float uri_length = log10length(uri);
-
-    // Skip if the URI is too short
-    if (uri.size() <= 1) {
-        return floatPrecision(uri_length, 1) + "||||||";
-    }
-
-    std::stringstream fingerprint;
-
-    // faup_options_new() is not thread safe, and should only be runned once per
-    // code, it is also the part that loads the cached publicsuffix.org file
-    faup_options_t* faup_opts;
-    faup_opts = faup_options_new();
-
-    // no need for the default csv output
-    faup_opts->output = FAUP_OUTPUT_NONE;
-
-    // modules slow down faup_init(), should be loaded only when needed
-    faup_opts->exec_modules = FAUP_MODULES_NOEXEC;
-
-    // fh is a pointer to a c struct that has, among others, all the positions
-    // where the uri splits in host, tld, etc.
-    faup_handler_t* fh;
-
-    // init the faup handler
-    fh = faup_init(faup_opts);
-
-    faup_decode(fh, uri.c_str(), uri.size());
-
-    // get path with faup
-    const std::string path =
-    uri.substr(faup_get_resource_path_pos(fh), faup_get_resource_path_size(fh));
-
-    // Compute fields
-    URIDirectoryData uri_dir_data = compute_uri_directory_data(path);
-    URIQueryData uri_query_data = compute_uri_query_data(uri, fh);
-
-    std::string ext = compute_uri_extention(path);
-
-    if (std::find(EXT.begin(), EXT.end(), ext) == EXT.end()) {
-        ext = "";
-    }
-
-    // Forge fingerprint
-    fingerprint << floatPrecision(uri_length, 1) << "|";
-    fingerprint << std::to_string(uri_dir_data.count) << "|"
-                << floatPrecision(uri_dir_data.avg_size_log, 1) << "|";
-    fingerprint << ext << "|";
-
-    if (uri_query_data.size != 0 || uri_query_data.count != 0 || uri_query_data.avg_size != .0 ||
-        uri_query_data.avg_size_log != .0) {
-        fingerprint << floatPrecision(log10f(static_cast<float>(uri_query_data.size)), 1) << "|"
-                    << std::to_string(uri_query_data.count) << "|"
-                    << floatPrecision(uri_query_data.avg_size_log, 1);
-    } else {
-        fingerprint << "||";
-    }
-
-    // Free pointers
-    faup_options_free(faup_opts);
-    faup_terminate(fh);
-
-    return fingerprint.str();
-}
-
-std::string method_fingerprint(const std::string& method) {
-    std::string res(method, 0, 2);
-
-    return res;
-}
-
-std::string version_fingerprint(const std::string& version) {
-    if (version.empty()) {
-        return "9";
-    }
-
-    std::string res(version, 0, 1);
-
-    return res;
-}
-
-std::string header_fingerprint(const std::vector<std::string>& headers) {
-    std::string header_order = getHeaderOrder(headers);
-    std::vector<std::string> result;
-
-    // Compute fields
-    for (const std::string& header: headers) {
-        std::vector<std::string> res;
-        boost::split(res, header, boost::is_any_of(":"));
-        std::string headerLower = boost::to_lower_copy(res[0]);
-
-        if (headerLower == "connection") {
-            result.emplace_back(getHeaderValue(header, headerLower, CONN));
-        } else if (headerLower == "accept-encoding") {
-            result.emplace_back(getHeaderValue(header, headerLower, AE));
-        } else if (headerLower == "content-encoding") {
-            result.emplace_back(getHeaderValue(header, headerLower, CONTENC));
-        } else if (headerLower == "cache-control") {
-            result.emplace_back(getHeaderValue(header, headerLower, CACHECONT));
-        } else if (headerLower == "te") {
-            result.emplace_back(getHeaderValue(header, headerLower, TE));
-        } else if (headerLower == "accept-charset") {
-            result.emplace_back(getHeaderValue(header, headerLower, ACCEPTCHAR));
-        } else if (headerLower == "content-type") {
-            result.emplace_back(getContentType(header));
-        } else if (headerLower == "accept") {
-            result.emplace_back(getHeaderValue(header, headerLower, ACCEPT));
-        } else if (headerLower == "accept-language") {
-            // No trim for this header
-            result.emplace_back(getAcceptLanguageValue(header));
-        } else if (headerLower == "user-agent") {
-            result.emplace_back(getUaValue(header));
-        }
-    }
-
-    return header_order + "|" + boost::join(result, "/");
-}
-
-std::string payload_fingerprint(const std::string& payload) {
-    if (payload.empty()) {
-        return "||";
-    }
-
-    std::stringstream res;
-
-    res << "A|" << entropy(payload) << "|" << log10length(payload);
-
-    return res.str();
-}
-
-// ---- Submethods -----------------------------------------------------------------------
-
-std::string fnv1a_32(const std::string& str) {
-    // FNV-1a 32bit hash
-    // https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
-    // https://tools.ietf.org/html/draft-eastlake-fnv-03
-
-    uint32_t hash = 2166136261U; // NOLINT(readability-magic-numbers)
-
-    for (const char& c: str) {
-        hash ^= c;
-        hash *= 16777619U; // NOLINT(readability-magic-numbers)
-    }
-
-    return std::to_string(hash);
-}
-
-// Headers
-
-std::string getHeaderValue(const std::string& header,
-                           const std::string& headerName,
-                           const std::map<std::string, std::string>& headerValueTable) {
-    std::vector<std::string> header_values;
-
-    boost::split(header_values, header, boost::is_any_of(":"));
-    std::string val = header_values[1];
-    boost::trim(val);
-
-    std::string header_coded = HEADERS[headerName] + ":";
-
-    std::vector<std::string> res;
-
-    if (val.find(',') != std::string::npos) {
-        // simple splitting of compound values
-        if (val.find(";q=") != std::string::npos || val.find("; q=") != std::string::npos) {
-            // we do not tokenize compound values with quality parameters at this moment
-            std::stringstream str;
-            str << std::hex << stol(fnv1a_32(val));
-
-            return header_coded + str.str();
-        }
-
-        std::vector<std::string> t;
-        boost::split(t, val, boost::is_any_of(","));
-
-        for (std::string& j: t) {
-            boost::trim_left(j);
-            std::stringstream str;
-            str << std::hex << stol(fnv1a_32(j));
-            if (j.empty() || headerValueTable.find(j) == headerValueTable.end()) {
-                return header_coded + str.str();
-            }
-            res.emplace_back(headerValueTable.at(j));
-        }
-    } else {
-        std::string k;
-
-        if (headerValueTable.find(val) != headerValueTable.end()) {
-            k = headerValueTable.at(val);
-        } else {
-            std::stringstream str;
-            str << std::hex << stol(fnv1a_32(val));
-            k = str.str();
-        }
-
-        res.emplace_back(k);
-    }
-
-    return header_coded + boost::join(res, ",");
-}
-
-std::string getContentType(const std::string& header) {
-    std::vector<std::string> header_values;
-
-    boost::split(header_values, header, boost::is_any_of(":"));
-    std::string val = header_values[1];
-    boost::trim(val);
-
-    std::string header_coded = HEADERS["content-type"] + ":";
-    std::vector<std::string> res;
-
-    if (val.find(',') != std::string::npos) {
-        // Multiple values
-        std::vector<std::string> vals;
-
-        boost::split(vals, val, boost::is_any_of(","));
-
-        // Loop over values
-        for (std::string& val: vals) {
-            boost::trim_left(val);
-            std::stringstream str;
-            str << std::hex;
-
-            if (val.find(';') != std::string::npos) {
-                if (val.find("boundary=") != std::string::npos) {
-                    int boundIndex = val.find("boundary=");
-                    int boundOffset = std::strlen("boundary=");
-
-                    std::string valBound = val.substr(boundIndex + boundOffset);
-
-                    str << stol(fnv1a_32(valBound));
-
-                    return header_coded + str.str();
-                }
-
-                str << stol(fnv1a_32(val));
-                res.emplace_back(str.str());
-
-            } else {
-                str << stol(fnv1a_32(val));
-                std::string k = str.str();
-
-                if (CONTENT_TYPE.find(val) != CONTENT_TYPE.end()) {
-                    k = CONTENT_TYPE.at(val);
-                }
-
-                res.emplace_back(k);
-            }
-        }
-    } else {
-        // Only one value
-        std::stringstream str;
-        str << std::hex;
-
-        if (val.find(';') != std::string::npos) {
-            if (val.find("boundary=") == std::string::npos) {
-                str << stol(fnv1a_32(val));
-                return header_coded + str.str();
-            }
-
-            int boundIndex = val.find("boundary=");
-            int boundOffset = std::strlen("boundary=");
-
-            std::string valBound = val.substr(boundIndex + boundOffset);
-
-            str << stol(fnv1a_32(valBound));
-
-            return header_coded + str.str();
-        }
-
-        str << stol(fnv1a_32(val));
-        std::string k = str.str();
-
-        if (CONTENT_TYPE.find(val) != CONTENT_TYPE.end()) {
-            k = CONTENT_TYPE.at(val);
-        }
-
-        res.emplace_back(k);
-    }
-
-    return header_coded + boost::join(res, ",");
-}
-
-std::string getAcceptLanguageValue(const std::string& header) {
-    std::vector<std::string> header_values;
-
-    boost::split(header_values, header, boost::is_any_of(":"));
-    std::string val = header_values[1];
-
-    std::string name = HEADERS["accept-language"];
-    std::stringstream str;
-
-    str << name << ":" << std::hex << stol(fnv1a_32(val));
-
-    return str.str();
-}
-
-std::string getUaValue(const std::string& header) {
-    std::vector<std::string> header_values;
-
-    boost::split(header_values, header, boost::is_any_of(":"));
-    std::string val = header_values[1];
-    boost::trim(val);
-
-    std::string name = HEADERS["user-agent"];
-    std::stringstream str;
-
-    str << name << ":" << std::hex << stol(fnv1a_32(val));
-
-    return str.str();
-}
-
-// Checking header order - assuming that header field contains ":"
-std::string getHeaderOrder(const std::vector<std::string>& headers) {
-    std::vector<std::string> ret;
-
-    for (const auto& reqline: headers) {
-        std::vector<std::string> fields;
-        boost::split(fields, reqline, boost::is_any_of(":"));
-        std::string header = fields[0];
-        std::string headerLower = boost::to_lower_copy(header);
-
-        std::string fnv1a = fnv1a_32(header);
-        std::string headerCoded;
-
-        // Convert fnv1a_32 to hex
-        std::stringstream ss;
-        ss << std::hex << stol(fnv1a);
-        headerCoded = ss.str();
-
-        if (HEADERS.find(headerLower) != HEADERS.end()) {
-            if (getHeaderCase(header)) {
-                headerCoded = HEADERS[headerLower];
-            } else {
-                headerCoded = "!" + HEADERS[headerLower];
-            }
-        }
-        ret.emplace_back(headerCoded);
-    }
-
-    return boost::join(ret, ",");
-}
-
-bool getHeaderCase(const std::string& header) {
-    if (header.find('-') == std::string::npos) {
-        return isupper(header[0]) != 0;
-    }
-
-    std::vector<std::string> field;
-    boost::split(field, header, boost::is_any_of("-"));
-
-    for (const auto& c: field) {
-        if (islower(c[0]) != 0) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-
-// URI
-
-URIDirectoryData compute_uri_directory_data(const std::string& path) {
-    URIDirectoryData res = { 0, .0, .0 };
-
-    std::vector<std::string> tokenized_path;
-    boost::split(tokenized_path, path, boost::is_any_of("/"));
-
-    // Remove first element of tokenized_path as it is empty
-    tokenized_path.erase(tokenized_path.begin());
-
-    res.count = tokenized_path.size();
-
-    if (res.count == 0) {
-        return res;
-    }
-
-    // Compute average directory size
-    for (auto& dir: tokenized_path) {
-        res.avg_size += dir.size();
-    }
-    res.avg_size = res.avg_size / static_cast<float>(res.count);
-
-    // Convert to log10
-    res.avg_size_log = log10f(res.avg_size);
-
-    return res;
-}
-
-URIQueryData compute_uri_query_data(const std::string& uri, faup_handler_t* fh) {
-    URIQueryData res = { 0, 0, .0, .0 };
-
-    auto string_pos = faup_get_query_string_pos(fh);
-    auto string_size = faup_get_query_string_size(fh);
-
-    if (string_pos == -1) {
-        return res;
-    }
-
-    std::string query = uri.substr(string_pos, string_size);
-    auto queries = get_query_parameters(query);
-
-    res.size = query.size();
-    res.count = queries.size();
-
-    if (res.count == 0) {
-        return res;
-    }
-
-    // Compute average query size
-    for (auto& q: queries) {
-        res.avg_size += q.second.size();
-    }
-    res.avg_size = res.avg_size / static_cast<float>(res.count);
-
-    // Convert to log10
-    res.avg_size_log = log10f(res.avg_size);
-
-    return res;
-}
-
-std::string compute_uri_extention(const std::string& path) {
-    namespace fs = std::filesystem;
-
-    std::string ext = fs::path(path).extension().string();
-
-    if (ext.empty()) {
-        return ext;
-    }
-
-    ext.erase(0, 1);
-
-    return ext;
-}
-
-// Function adapted from POCO library
-// https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L669
-void decode(const std::string& str, std::string& decodedStr) {
-    std::string::const_iterator it = str.begin();
-    std::string::const_iterator end = str.end();
-
-    const int OFFSET = 10;
-    const int HEX_OFFSET = 16;
-
-    while (it != end) {
-        int c = *it++;
-
-        if (c == '%') {
-            if (it == end) {
-                throw std::exception();
-            }
-            int hi = *it++;
-            if (it == end) {
-                throw std::exception();
-            }
-            int lo = *it++;
-            if (hi >= '0' && hi <= '9') {
-                c = hi - '0';
-            } else if (hi >= 'A' && hi <= 'F') {
-                c = hi - 'A' + OFFSET;
-            } else if (hi >= 'a' && hi <= 'f') {
-                c = hi - 'a' + OFFSET;
-            } else {
-                throw std::exception();
-            }
-            c *= HEX_OFFSET;
-            if (lo >= '0' && lo <= '9') {
-                c += lo - '0';
-            } else if (lo >= 'A' && lo <= 'F') {
-                c += lo - 'A' + OFFSET;
-            } else if (lo >= 'a' && lo <= 'f') {
-                c += lo - 'a' + OFFSET;
-            } else {
-                throw std::exception();
-            }
-        }
-
-        decodedStr += static_cast<char>(c);
-    }
-}
-
-// Function adapted from POCO library
-// https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L373
-std::vector<std::pair<std::string, std::string>> get_query_parameters(const std::string& query) {
-    std::vector<std::pair<std::string, std::string>> result;
-
-    std::string::const_iterator it(query.begin());
-    std::string::const_iterator end(query.end());
-
-    while (it != end) {
-        std::string name;
-        std::string value;
-
-        while (it != end && *it != '=' && *it != '&') {
-            if (*it == '+') {
-                name += ' ';
-            } else {
-                name += *it;
-            }
-            ++it;
-        }
-        if (it != end && *it == '=') {
-            ++it;
-            while (it != end && *it != '&') {
-                if (*it == '+') {
-                    value += ' ';
-                } else {
-                    value += *it;
-                }
-                ++it;
-            }
-        }
-
-        std::string decodedName;
-        std::string decodedValue;
-
-        decode(name, decodedName);
-        decode(value, decodedValue);
-
-        result.push_back(std::make_pair(decodedName, decodedValue));
-
-        if (it != end && *it == '&') {
-            ++it;
-        }
-    }
-
-    return result;
-}
-
-// Others
-
-float entropy(const std::string& str) {
-    float entropy = 0;
-
-    const auto occurrences = charOccurrences(str);
-
-    for (const auto& item: occurrences) {
-        float p = item.second / static_cast<float>(str.size());
-        entropy += p * std::log2f(p);
-    }
-
-    return std::roundf((-entropy) * 10) / 10; // NOLINT(readability-magic-numbers)
-}
-
-//--------------------------------------------------------------------------------------//
-//                                       Helpers                                        //
-//--------------------------------------------------------------------------------------//
-
-std::map<char, int> charOccurrences(const std::string& str) {
-    std::map<char, int> occurrences;
-
-    for (const char& c: str) {
-        if (occurrences.find(c) == occurrences.end()) {
-            occurrences[c] = 1;
-        } else {
-            occurrences[c]++;
-        }
-    }
-
-    return occurrences;
-}
-
-float log10length(const std::string& str) {
-    return std::roundf(log10f(str.size()) * 10) / 10; // NOLINT(readability-magic-numbers)
-}
-
-std::string floatPrecision(const float& v, const int& p) {
-    std::stringstream ss;
-
-    ss << std::fixed << std::setprecision(p) << v;
-
-    return ss.str();
-}
+/**
+ * @file fingerprint.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of HTTP Fingerprinting methods
+ * @version 1.0.0
+ * @date 2022-03-03
+ */
+#include <algorithm>
+#include <array>
+#include <boost/algorithm/string.hpp>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <finger/cache.hpp>
+#include <finger/fingerprint.hpp>
+#include <finger/payload.hpp>
+#include <finger/tables.hpp>
+#include <iomanip>
+#include <limits>
+#include <map>
+
+/**
+ * @brief Name of the Content-Type parameter holding the multipart boundary
+ */
+static constexpr std::string_view BOUNDARY = "boundary=";
+
+/**
+ * @brief Characters trimmed from the header values
+ */
+static constexpr std::string_view WHITESPACES = " \t\n\v\f\r";
+
+/**
+ * @brief Number of 1 decimal buckets of the length magnitude, up to log10(2^64) = 19.3
+ */
+static constexpr std::size_t LOG10_BUCKETS = 194;
+
+/**
+ * @brief Size of the buffers used to format floats (fixed notation of the largest float)
+ */
+static constexpr std::size_t FLOAT_BUFFER_SIZE = 64;
+
+/**
+ * @brief Size of the c·log2(c) table used by the entropy computation
+ */
+static constexpr std::size_t CLOG2C_TABLE_SIZE = 4096;
+
+/**
+ * @brief Distance (in tenths) to a rounding boundary under which the entropy estimate is not
+ * trusted
+ */
+static constexpr double ENTROPY_ROUNDING_MARGIN = 0.01;
+
+/**
+ * @brief Headers whose value is encoded in the fingerprint (lowercase)
+ */
+static constexpr std::array<std::string_view, 10> ENCODED_HEADERS = {
+    "connection",     "accept-encoding", "content-encoding", "cache-control",   "te",
+    "accept-charset", "content-type",    "accept",           "accept-language", "user-agent",
+};
+
+//--------------------------------------------------------------------------------------//
+//                               Fingerprint Computation                                //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Get the encoded value of the header from the value cache of the calling thread,
+ * computes and stores it on a miss (or simply computes it when memoization is disabled)
+ */
+template<typename Compute>
+static std::string
+memoizedHeaderValue(CachedHeader kind, std::string_view value, Compute compute) {
+    ConfigGuard config;
+    ValueCache* cache = value_cache(kind, config.generation());
+
+    if (cache == nullptr) {
+        return compute();
+    }
+
+    std::size_t hash = std::hash<std::string_view> {}(value);
+
+    if (const std::string* encoded = cache->find(value, hash)) {
+        return *encoded;
+    }
+
+    return cache->insert(value, hash, compute());
+}
+
+std::string fingerprint(const HTTPRequest& req) {
+    // The whole fingerprint is computed with the same tables, even if others are loaded meanwhile
+    ConfigGuard config;
+    std::stringstream fingerprint;
+
+    fingerprint << uri_fingerprint(req.uri) << "|";
+    fingerprint << method_fingerprint(req.method) << "|";
+    fingerprint << version_fingerprint(req.version) << "|";
+    fingerprint << header_fingerprint(req.headers) << "|";
+    fingerprint << payload_fingerprint(req.payload);
+
+    return fingerprint.str();
+}
+
+std::string uri_fingerprint(const std::string& uri) {
+    float uri_length = log10length(uri);
+
+    // Skip if the URI is too short
+    if (uri.size() <= 1) {
+        return floatPrecision(uri_length, 1) + "||||||";
+    }
+
+    std::stringstream fingerprint;
+
+    URIParts parts = parse_uri(uri, true);
+
+    // Compute fields
+    URIDirectoryData uri_dir_data = compute_uri_directory_data(parts.path);
+    URIQueryData uri_query_data = parts.query;
+
+    std::string ext = compute_uri_extention(parts.path);
+
+    if (!ConfigGuard()->ext.contains(ext)) {
+        ext = "";
+    }
+
+    // Forge fingerprint
+    fingerprint << floatPrecision(uri_length, 1) << "|";
+    fingerprint << std::to_string(uri_dir_data.count) << "|"
+                << floatPrecision(uri_dir_data.avg_size_log, 1) << "|";
+    fingerprint << ext << "|";
+
+    if (uri_query_data.size != 0 || uri_query_data.count != 0 || uri_query_data.avg_size != .0 ||
+        uri_query_data.avg_size_log != .0) {
+        fingerprint << floatPrecision(log10f(static_cast<float>(uri_query_data.size)), 1) << "|"
+                    << std::to_string(uri_query_data.count) << "|"
+                    << floatPrecision(uri_query_data.avg_size_log, 1);
+    } else {
+        fingerprint << "||";
+    }
+
+    return fingerprint.str();
+}
+
+URIParts parse_uri(const std::string& uri, bool query) {
+    URIParts parts = { "", { 0, 0, .0, .0 } };
+
+    // faup_options_new() is not thread safe, and should only be runned once per
+    // code, it is also the part that loads the cached publicsuffix.org file
+    faup_options_t* faup_opts;
+    faup_opts = faup_options_new();
+
+    // no need for the default csv output
+    faup_opts->output = FAUP_OUTPUT_NONE;
+
+    // modules slow down faup_init(), should be loaded only when needed
+    faup_opts->exec_modules = FAUP_MODULES_NOEXEC;
+
+    // fh is a pointer to a c struct that has, among others, all the positions
+    // where the uri splits in host, tld, etc.
+    faup_handler_t* fh;
+
+    // init the faup handler
+    fh = faup_init(faup_opts);
+
+    faup_decode(fh, uri.c_str(), uri.size());
+
+    // get path with faup
+    parts.path = uri.substr(faup_get_resource_path_pos(fh), faup_get_resource_path_size(fh));
+
+    if (query) {
+        parts.query = compute_uri_query_data(uri, fh);
+    }
+
+    // Free pointers
+    faup_options_free(faup_opts);
+    faup_terminate(fh);
+
+    return parts;
+}
+
+std::string method_fingerprint(const std::string& method) {
+    std::string res(method, 0, 2);
+
+    return res;
+}
+
+std::string version_fingerprint(const std::string& version) {
+    if (version.empty()) {
+        return "9";
+    }
+
+    std::string res(version, 0, 1);
+
+    return res;
+}
+
+std::string header_fingerprint(const std::vector<std::string>& headers) {
+    std::vector<HeaderView> views;
+    views.reserve(headers.size());
+
+    for (const std::string& header: headers) {
+        views.emplace_back(splitHeaderLine(header));
+    }
+
+    return encodeHeaders(views);
+}
+
+std::string header_fingerprint(std::span<const HeaderField> headers) {
+    std::vector<HeaderView> views;
+    views.reserve(headers.size());
+
+    for (const HeaderField& header: headers) {
+        views.emplace_back(headerFieldView(header));
+    }
+
+    return encodeHeaders(views);
+}
+
+/**
+ * @brief Computes the headers fingerprint, without going through the header block cache
+ */
+static std::string computeHeaders(const std::vector<HeaderView>& headers) {
+    return encodeHeaderOrder(headers) + "|" + encodeHeaderValues(headers);
+}
+
+std::string encodeHeaderValues(const std::vector<HeaderView>& headers) {
+    ConfigGuard config;
+    std::vector<std::string> result;
+    std::string headerLower;
+
+    // Compute fields
+    for (const HeaderView& header: headers) {
+        headerLower.assign(header.name);
+        boost::to_lower(headerLower);
+
+        std::string_view val = trimView(header.value);
+
+        if (headerLower == "connection") {
+            result.emplace_back(encodeHeaderValue(val, headerLower, config->conn));
+        } else if (headerLower == "accept-encoding") {
+            result.emplace_back(encodeHeaderValue(val, headerLower, config->ae));
+        } else if (headerLower == "content-encoding") {
+            result.emplace_back(encodeHeaderValue(val, headerLower, config->contenc));
+        } else if (headerLower == "cache-control") {
+            result.emplace_back(encodeHeaderValue(val, headerLower, config->cachecont));
+        } else if (headerLower == "te") {
+            result.emplace_back(encodeHeaderValue(val, headerLower, config->te));
+        } else if (headerLower == "accept-charset") {
+            result.emplace_back(encodeHeaderValue(val, headerLower, config->acceptchar));
+        } else if (headerLower == "content-type") {
+            result.emplace_back(encodeContentType(val));
+        } else if (headerLower == "accept") {
+            result.emplace_back(memoizedHeaderValue(CachedHeader::Accept, val, [&]() {
+                return encodeHeaderValue(val, headerLower, config->accept);
+            }));
+        } else if (headerLower == "accept-language") {
+            // No trim for this header, only values following the usual space are memoized as the
+            // space is not part of the key
+            auto compute = [&]() { return encodeAcceptLanguage(header); };
+            result.emplace_back(header.spaced ? memoizedHeaderValue(
+                                                CachedHeader::AcceptLanguage, header.value, compute)
+                                              : compute());
+        } else if (headerLower == "user-agent") {
+            result.emplace_back(
+            memoizedHeaderValue(CachedHeader::UserAgent, val, [&]() { return encodeUa(val); }));
+        }
+    }
+
+    return boost::join(result, "/");
+}
+
+std::string encodeHeaders(const std::vector<HeaderView>& headers) {
+    ConfigGuard config;
+    ValueCache* cache = header_cache(config.generation());
+
+    if (cache == nullptr) {
+        return computeHeaders(headers);
+    }
+
+    // Reused across calls, the key buffer stops allocating once it reached the usual block size
+    thread_local std::string key;
+    headerBlockKey(headers, key);
+
+    std::size_t hash = std::hash<std::string_view> {}(key);
+
+    if (const std::string* encoded = cache->find(key, hash)) {
+        return *encoded;
+    }
+
+    return cache->insert(key, hash, computeHeaders(headers));
+}
+
+void headerBlockKey(const std::vector<HeaderView>& headers, std::string& key) {
+    std::string headerLower;
+
+    // Length prefixed fields, so that no two different blocks share a key
+    auto append = [&key](std::string_view field) {
+        auto size = static_cast<std::uint32_t>(field.size());
+
+        key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        key.append(field);
+    };
+
+    key.clear();
+
+    for (const HeaderView& header: headers) {
+        append(header.name);
+
+        headerLower.assign(header.name);
+        boost::to_lower(headerLower);
+
+        if (std::find(ENCODED_HEADERS.begin(), ENCODED_HEADERS.end(), headerLower) ==
+            ENCODED_HEADERS.end()) {
+            key += '\0';
+            continue;
+        }
+
+        key += header.spaced ? '\1' : '\2';
+        append(header.value);
+    }
+}
+
+std::string payload_fingerprint(const std::string& payload) {
+    PayloadAccumulator accumulator;
+
+    accumulator.update(payload);
+
+    return accumulator.finish();
+}
+
+// ---- Submethods -----------------------------------------------------------------------
+
+std::string fnv1a_32(const std::string& str) {
+    return std::to_string(fnv1a_32_update(FNV1A_32_OFFSET_BASIS, str));
+}
+
+std::uint32_t fnv1a_32_update(std::uint32_t hash, std::string_view str) {
+    // FNV-1a 32bit hash
+    // https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+    // https://tools.ietf.org/html/draft-eastlake-fnv-03
+
+    for (const char& c: str) {
+        hash ^= c;
+        hash *= 16777619U; // NOLINT(readability-magic-numbers)
+    }
+
+    return hash;
+}
+
+std::string hexString(std::uint32_t value) {
+    std::array<char, 8> buffer {}; // NOLINT(readability-magic-numbers)
+
+    auto [end, ec] = std::to_chars(buffer.begin(), buffer.end(), value, 16);
+
+    return { buffer.begin(), end };
+}
+
+std::string hexHash(std::string_view str) {
+    return hexString(fnv1a_32_update(FNV1A_32_OFFSET_BASIS, str));
+}
+
+// Headers
+
+HeaderView splitHeaderLine(std::string_view line) {
+    std::size_t colon = line.find(':');
+
+    if (colon == std::string_view::npos) {
+        return { line, {}, false };
+    }
+
+    std::string_view value = line.substr(colon + 1);
+    value = value.substr(0, value.find(':'));
+
+    if (!value.empty() && value.front() == ' ') {
+        return { line.substr(0, colon), value.substr(1), true };
+    }
+
+    return { line.substr(0, colon), value, false };
+}
+
+HeaderView headerFieldView(const HeaderField& field) {
+    return { field.first, field.second.substr(0, field.second.find(':')), true };
+}
+
+std::string_view trimView(std::string_view str) {
+    str = trimLeftView(str);
+
+    return str.substr(0, str.find_last_not_of(WHITESPACES) + 1);
+}
+
+std::string_view trimLeftView(std::string_view str) {
+    std::size_t begin = str.find_first_not_of(WHITESPACES);
+
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+
+    return str.substr(begin);
+}
+
+std::string getHeaderValue(const std::string& header,
+                           const std::string& headerName,
+                           FrozenMapView headerValueTable) {
+    return encodeHeaderValue(trimView(splitHeaderLine(header).value), headerName, headerValueTable);
+}
+
+std::string encodeHeaderValue(std::string_view val,
+                              const std::string& headerName,
+                              FrozenMapView headerValueTable) {
+    std::string header_coded = std::string(ConfigGuard()->headers.find(headerName)) + ":";
+
+    // Single pass over the comma separated tokens: codes of the known tokens are appended as they
+    // come, the first unknown token is remembered and the rest of the value is only scanned for
+    // quality parameters
+    std::string codes;
+    std::string_view unknown;
+    bool hasUnknown = false;
+    std::size_t start = 0;
+
+    while (true) {
+        std::size_t comma = val.find(',', start);
+
+        if (comma == std::string_view::npos && start == 0) {
+            // Single value
+            std::string_view code = headerValueTable.find(val);
+
+            return header_coded + (code.empty() ? hexHash(val) : std::string(code));
+        }
+
+        std::string_view token = val.substr(start, comma - start);
+
+        if (hasQualityParameter(token)) {
+            // we do not tokenize compound values with quality parameters at this moment
+            return header_coded + hexHash(val);
+        }
+
+        if (!hasUnknown) {
+            token = trimLeftView(token);
+            std::string_view code = headerValueTable.find(token);
+
+            if (token.empty() || code.empty()) {
+                unknown = token;
+                hasUnknown = true;
+            } else {
+                codes += codes.empty() ? "" : ",";
+                codes += code;
+            }
+        }
+
+        if (comma == std::string_view::npos) {
+            break;
+        }
+
+        start = comma + 1;
+    }
+
+    return header_coded + (hasUnknown ? hexHash(unknown) : codes);
+}
+
+bool hasQualityParameter(std::string_view token) {
+    for (std::size_t i = token.find(';'); i != std::string_view::npos; i = token.find(';', i + 1)) {
+        std::string_view param = token.substr(i + 1);
+
+        if (param.starts_with("q=") || param.starts_with(" q=")) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::string getContentType(const std::string& header) {
+    return encodeContentType(trimView(splitHeaderLine(header).value));
+}
+
+std::string encodeContentType(std::string_view val) {
+    ConfigGuard config;
+    std::string header_coded = std::string(config->headers.find("content-type")) + ":";
+    std::vector<std::string> res;
+
+    if (val.find(',') != std::string_view::npos) {
+        // Multiple values
+        std::vector<std::string_view> vals;
+
+        boost::split(vals, val, boost::is_any_of(","));
+
+        // Loop over values
+        for (std::string_view val: vals) {
+            val = trimLeftView(val);
+
+            if (val.find(';') != std::string_view::npos) {
+                std::size_t boundIndex = val.find("boundary=");
+
+                if (boundIndex != std::string_view::npos) {
+                    return header_coded + hexHash(val.substr(boundIndex + BOUNDARY.size()));
+                }
+
+                res.emplace_back(hexHash(val));
+
+            } else {
+                std::string_view code = config->content_type.find(val);
+
+                res.emplace_back(code.empty() ? hexHash(val) : std::string(code));
+            }
+        }
+    } else {
+        // Only one value
+        if (val.find(';') != std::string_view::npos) {
+            std::size_t boundIndex = val.find("boundary=");
+
+            if (boundIndex == std::string_view::npos) {
+                return header_coded + hexHash(val);
+            }
+
+            return header_coded + hexHash(val.substr(boundIndex + BOUNDARY.size()));
+        }
+
+        std::string_view code = config->content_type.find(val);
+
+        res.emplace_back(code.empty() ? hexHash(val) : std::string(code));
+    }
+
+    return header_coded + boost::join(res, ",");
+}
+
+std::string getAcceptLanguageValue(const std::string& header) {
+    return encodeAcceptLanguage(splitHeaderLine(header));
+}
+
+std::string encodeAcceptLanguage(const HeaderView& header) {
+    // The value is hashed untrimmed, including the space following the colon
+    std::uint32_t hash = FNV1A_32_OFFSET_BASIS;
+
+    if (header.spaced) {
+        hash = fnv1a_32_update(hash, " ");
+    }
+
+    hash = fnv1a_32_update(hash, header.value);
+
+    return std::string(ConfigGuard()->headers.find("accept-language")) + ":" + hexString(hash);
+}
+
+std::string getUaValue(const std::string& header) {
+    return encodeUa(trimView(splitHeaderLine(header).value));
+}
+
+std::string encodeUa(std::string_view val) {
+    return std::string(ConfigGuard()->headers.find("user-agent")) + ":" + hexHash(val);
+}
+
+// Checking header order - assuming that header field contains ":"
+std::string getHeaderOrder(const std::vector<std::string>& headers) {
+    std::vector<HeaderView> views;
+    views.reserve(headers.size());
+
+    for (const std::string& header: headers) {
+        views.emplace_back(splitHeaderLine(header));
+    }
+
+    return encodeHeaderOrder(views);
+}
+
+std::string encodeHeaderOrder(const std::vector<HeaderView>& headers) {
+    ConfigGuard config;
+    std::vector<std::string> ret;
+    std::string headerLower;
+
+    for (const HeaderView& view: headers) {
+        headerLower.assign(view.name);
+        boost::to_lower(headerLower);
+
+        std::string_view known = config->headers.find(headerLower);
+
+        if (known.empty()) {
+            ret.emplace_back(hexHash(view.name));
+        } else if (getHeaderCase(view.name)) {
+            ret.emplace_back(known);
+        } else {
+            ret.emplace_back("!" + std::string(known));
+        }
+    }
+
+    return boost::join(ret, ",");
+}
+
+HeaderMasks encodeHeaderMasks(const std::vector<HeaderView>& headers) {
+    ConfigGuard config;
+    HeaderMasks masks;
+    std::string headerLower;
+    std::size_t bits = std::min(config->headers.size(), HEADER_MASK_BITS);
+
+    for (const HeaderView& view: headers) {
+        headerLower.assign(view.name);
+        boost::to_lower(headerLower);
+
+        std::size_t known = config->headers.index(headerLower);
+
+        if (known >= bits) {
+            continue;
+        }
+
+        std::uint64_t bit = std::uint64_t(1) << known;
+
+        masks.presence |= bit;
+
+        if (getHeaderCase(view.name)) {
+            masks.uppercase |= bit;
+        }
+    }
+
+    return masks;
+}
+
+ValueBits encodeValueBits(const std::vector<HeaderView>& headers) {
+    ConfigGuard config;
+    ValueBits bits;
+    std::string headerLower;
+
+    for (const HeaderView& view: headers) {
+        headerLower.assign(view.name);
+        boost::to_lower(headerLower);
+
+        auto header = std::find(VALUE_HEADERS.begin(), VALUE_HEADERS.end(), headerLower);
+
+        // Values of headers without a code cannot be told apart in the fingerprint
+        if (header == VALUE_HEADERS.end() || !config->headers.contains(headerLower)) {
+            continue;
+        }
+
+        // Same tokens as encodeHeaderValue(), the first VALUE_TOKEN_BITS ones of the table
+        auto h = static_cast<std::size_t>(header - VALUE_HEADERS.begin());
+        FrozenMapView table = (*config).*VALUE_TABLES[h];
+        std::size_t known_tokens = std::min(table.size(), VALUE_TOKEN_BITS);
+        std::string_view val = trimView(view.value);
+        std::uint16_t tokens = 0;
+        bool known = true;
+
+        if (val.find(',') == std::string_view::npos) {
+            std::size_t j = table.index(val);
+
+            known = j < known_tokens;
+            tokens = known ? static_cast<std::uint16_t>(1U << j) : 0;
+        } else {
+            std::size_t start = 0;
+
+            while (known) {
+                std::size_t comma = std::min(val.find(',', start), val.size());
+                std::string_view token = val.substr(start, comma - start);
+                std::size_t j = table.index(trimLeftView(token));
+
+                known = !hasQualityParameter(token) && j < known_tokens;
+                tokens |= known ? static_cast<std::uint16_t>(1U << j) : 0;
+
+                if (comma == val.size()) {
+                    break;
+                }
+
+                start = comma + 1;
+            }
+        }
+
+        bits.add(h, tokens, known);
+    }
+
+    return bits;
+}
+
+bool getHeaderCase(std::string_view header) {
+    // SWAR classification, 8 bytes at a time: a segment starts at the first byte and after each
+    // '-', the header is in upper case if no segment starts with a lowercase letter (and, when
+    // there is a single segment, if it starts with an uppercase letter)
+    constexpr std::uint64_t ones = 0x0101010101010101ULL;   // NOLINT(readability-magic-numbers)
+    constexpr std::uint64_t highs = 0x8080808080808080ULL;  // NOLINT(readability-magic-numbers)
+    constexpr std::uint64_t lows = 0x7F7F7F7F7F7F7F7FULL;   // NOLINT(readability-magic-numbers)
+    constexpr std::uint64_t dashes = ones * '-';
+    constexpr int byte_bits = 8;
+
+    if (header.empty()) {
+        return false;
+    }
+
+    std::uint64_t starts = highs & 0xFFULL; // NOLINT(readability-magic-numbers)
+    bool dashed = false;
+
+    for (std::size_t i = 0; i < header.size(); i += sizeof(std::uint64_t)) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, header.data() + i, std::min(sizeof(word), header.size() - i));
+
+        // High bit set on the bytes equal to '-'
+        std::uint64_t x = word ^ dashes;
+        std::uint64_t dash = ~(((x & lows) + lows) | x) & highs;
+
+        // High bit set on the bytes in [a-z]
+        std::uint64_t ascii = ~word & highs;
+        std::uint64_t above_a = ((word & lows) + ones * (0x80 - 'a')) & highs;
+        std::uint64_t above_z = ((word & lows) + ones * (0x80 - 'z' - 1)) & highs;
+        std::uint64_t lower = ascii & above_a & ~above_z;
+
+        if (((starts | (dash << byte_bits)) & lower) != 0) {
+            return false;
+        }
+
+        // A dash in the last byte starts a segment in the next word
+        starts = dash >> (byte_bits * (sizeof(word) - 1));
+        dashed = dashed || dash != 0;
+    }
+
+    if (!dashed) {
+        return header[0] >= 'A' && header[0] <= 'Z';
+    }
+
+    return true;
+}
+
+void getHeaderCases(std::span<const HeaderView> headers, std::span<bool> cases) {
+    if (cases.size() < headers.size()) {
+        throw std::invalid_argument("getHeaderCases: output smaller than the header list");
+    }
+
+    for (std::size_t i = 0; i < headers.size(); i++) {
+        cases[i] = getHeaderCase(headers[i].name);
+    }
+}
+
+
+// URI
+
+URIDirectoryData compute_uri_directory_data(const std::string& path) {
+    URIDirectoryData res = { 0, .0, .0 };
+
+    std::vector<std::string> tokenized_path;
+    boost::split(tokenized_path, path, boost::is_any_of("/"));
+
+    // Remove first element of tokenized_path as it is empty
+    tokenized_path.erase(tokenized_path.begin());
+
+    res.count = tokenized_path.size();
+
+    if (res.count == 0) {
+        return res;
+    }
+
+    // Compute average directory size
+    for (auto& dir: tokenized_path) {
+        res.avg_size += dir.size();
+    }
+    res.avg_size = res.avg_size / static_cast<float>(res.count);
+
+    // Convert to log10
+    res.avg_size_log = log10f(res.avg_size);
+
+    return res;
+}
+
+URIQueryData compute_uri_query_data(const std::string& uri, faup_handler_t* fh) {
+    URIQueryData res = { 0, 0, .0, .0 };
+
+    auto string_pos = faup_get_query_string_pos(fh);
+    auto string_size = faup_get_query_string_size(fh);
+
+    if (string_pos == -1) {
+        return res;
+    }
+
+    std::string query = uri.substr(string_pos, string_size);
+    auto queries = get_query_parameters(query);
+
+    res.size = query.size();
+    res.count = queries.size();
+
+    if (res.count == 0) {
+        return res;
+    }
+
+    // Compute average query size
+    for (auto& q: queries) {
+        res.avg_size += q.second.size();
+    }
+    res.avg_size = res.avg_size / static_cast<float>(res.count);
+
+    // Convert to log10
+    res.avg_size_log = log10f(res.avg_size);
+
+    return res;
+}
+
+std::string compute_uri_extention(const std::string& path) {
+    namespace fs = std::filesystem;
+
+    std::string ext = fs::path(path).extension().string();
+
+    if (ext.empty()) {
+        return ext;
+    }
+
+    ext.erase(0, 1);
+
+    return ext;
+}
+
+// Function adapted from POCO library
+// https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L669
+void decode(const std::string& str, std::string& decodedStr) {
+    std::string::const_iterator it = str.begin();
+    std::string::const_iterator end = str.end();
+
+    const int OFFSET = 10;
+    const int HEX_OFFSET = 16;
+
+    while (it != end) {
+        int c = *it++;
+
+        if (c == '%') {
+            if (it == end) {
+                throw std::exception();
+            }
+            int hi = *it++;
+            if (it == end) {
+                throw std::exception();
+            }
+            int lo = *it++;
+            if (hi >= '0' && hi <= '9') {
+                c = hi - '0';
+            } else if (hi >= 'A' && hi <= 'F') {
+                c = hi - 'A' + OFFSET;
+            } else if (hi >= 'a' && hi <= 'f') {
+                c = hi - 'a' + OFFSET;
+            } else {
+                throw std::exception();
+            }
+            c *= HEX_OFFSET;
+            if (lo >= '0' && lo <= '9') {
+                c += lo - '0';
+            } else if (lo >= 'A' && lo <= 'F') {
+                c += lo - 'A' + OFFSET;
+            } else if (lo >= 'a' && lo <= 'f') {
+                c += lo - 'a' + OFFSET;
+            } else {
+                throw std::exception();
+            }
+        }
+
+        decodedStr += static_cast<char>(c);
+    }
+}
+
+// Function adapted from POCO library
+// https://github.com/pocoproject/poco/blob/9d1c428c861f2e5ccf09149bbe8d2149720c5896/Foundation/src/URI.cpp#L373
+std::vector<std::pair<std::string, std::string>> get_query_parameters(const std::string& query) {
+    std::vector<std::pair<std::string, std::string>> result;
+
+    std::string::const_iterator it(query.begin());
+    std::string::const_iterator end(query.end());
+
+    while (it != end) {
+        std::string name;
+        std::string value;
+
+        while (it != end && *it != '=' && *it != '&') {
+            if (*it == '+') {
+                name += ' ';
+            } else {
+                name += *it;
+            }
+            ++it;
+        }
+        if (it != end && *it == '=') {
+            ++it;
+            while (it != end && *it != '&') {
+                if (*it == '+') {
+                    value += ' ';
+                } else {
+                    value += *it;
+                }
+                ++it;
+            }
+        }
+
+        std::string decodedName;
+        std::string decodedValue;
+
+        decode(name, decodedName);
+        decode(value, decodedValue);
+
+        result.push_back(std::make_pair(decodedName, decodedValue));
+
+        if (it != end && *it == '&') {
+            ++it;
+        }
+    }
+
+    return result;
+}
+
+// Others
+
+float entropy(const std::string& str) {
+    ByteHistogram counts {};
+
+    byteOccurrences(str, counts);
+
+    return histogramEntropy(counts, str.size());
+}
+
+void byteOccurrences(std::string_view str, ByteHistogram& counts) {
+    // Four sub-histograms filled in turn, so that runs of the same byte do not wait for the
+    // previous increment of the same counter to be stored
+    constexpr std::size_t ways = 4;
+    constexpr std::size_t chunk = std::size_t { 1 } << 30U; // keeps the 32-bit counters exact
+
+    std::array<std::array<std::uint32_t, BYTE_VALUES>, ways> partial {};
+    const auto* data = reinterpret_cast<const unsigned char*>(str.data());
+
+    for (std::size_t begin = 0; begin < str.size(); begin += chunk) {
+        std::size_t end = std::min(str.size(), begin + chunk);
+        std::size_t i = begin;
+
+        for (; i + ways <= end; i += ways) {
+            partial[0][data[i]]++;
+            partial[1][data[i + 1]]++;
+            partial[2][data[i + 2]]++;
+            partial[3][data[i + 3]]++;
+        }
+
+        for (; i < end; i++) {
+            partial[0][data[i]]++;
+        }
+
+        for (std::size_t c = 0; c < BYTE_VALUES; c++) {
+            counts[c] += partial[0][c] + partial[1][c] + partial[2][c] + partial[3][c];
+        }
+
+        partial = {};
+    }
+}
+
+float histogramEntropy(const ByteHistogram& counts, std::uint64_t size) {
+    // Table of c·log2(c) for the small counts, computed once
+    static const auto clog2c = []() {
+        std::array<double, CLOG2C_TABLE_SIZE> table {};
+
+        for (std::size_t c = 1; c < table.size(); c++) {
+            table[c] = static_cast<double>(c) * std::log2(static_cast<double>(c));
+        }
+
+        return table;
+    }();
+
+    std::size_t distinct = 0;
+    double sum = 0;
+
+    for (const std::uint64_t& c: counts) {
+        if (c == 0) {
+            continue;
+        }
+
+        distinct++;
+        sum += c < clog2c.size() ? clog2c[c]
+                                 : static_cast<double>(c) * std::log2(static_cast<double>(c));
+    }
+
+    // H = log2(n) - sum(c·log2(c)) / n
+    constexpr double HALF = 0.5;
+    constexpr double TENTHS = 10;
+    double n = static_cast<double>(size);
+    double scaled = (std::log2(n) - sum / n) * TENTHS;
+    double fraction = scaled - std::floor(scaled);
+
+    // The single precision sum over the bins (the historical computation) is only used when the
+    // estimate is too close to a rounding boundary to be sure both round the same way, or when the
+    // sign of the zero entropy matters (empty or single byte value payloads give -0)
+    if (distinct > 1 && std::abs(fraction - HALF) > ENTROPY_ROUNDING_MARGIN) {
+        return static_cast<float>(std::floor(scaled + HALF)) / static_cast<float>(TENTHS);
+    }
+
+    float entropy = 0;
+
+    // Same summation order as the former std::map<char, int>: negative chars first
+    for (std::size_t i = 0; i < BYTE_VALUES; i++) {
+        std::uint64_t c = counts[(i + BYTE_VALUES / 2) % BYTE_VALUES];
+
+        if (c != 0) {
+            float p = static_cast<float>(c) / static_cast<float>(size);
+            entropy += p * std::log2f(p);
+        }
+    }
+
+    return std::roundf((-entropy) * 10) / 10; // NOLINT(readability-magic-numbers)
+}
+
+//--------------------------------------------------------------------------------------//
+//                                       Helpers                                        //
+//--------------------------------------------------------------------------------------//
+
+std::map<char, int> charOccurrences(const std::string& str) {
+    std::map<char, int> occurrences;
+    ByteHistogram counts {};
+
+    byteOccurrences(str, counts);
+
+    for (std::size_t c = 0; c < BYTE_VALUES; c++) {
+        if (counts[c] != 0) {
+            occurrences[static_cast<char>(c)] = static_cast<int>(counts[c]);
+        }
+    }
+
+    return occurrences;
+}
+
+float log10length(const std::string& str) { return log10length(str.size()); }
+
+/**
+ * @brief Get the 1 decimal bucket (in tenths) of the length magnitude, computed in floating point
+ */
+static int log10bucket(std::uint64_t length) {
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    return static_cast<int>(std::roundf(log10f(static_cast<float>(length)) * 10));
+}
+
+float log10length(std::uint64_t length) {
+    // Smallest length of each bucket, searched once with the floating point computation itself so
+    // that the integer compares always agree with it
+    static const auto thresholds = []() {
+        std::array<std::uint64_t, LOG10_BUCKETS> table {};
+
+        for (std::size_t k = 1; k < table.size(); k++) {
+            std::uint64_t low = table[k - 1];
+            std::uint64_t high = std::numeric_limits<std::uint64_t>::max();
+
+            while (low < high) {
+                std::uint64_t mid = low + (high - low) / 2;
+
+                if (log10bucket(mid) >= static_cast<int>(k)) {
+                    high = mid;
+                } else {
+                    low = mid + 1;
+                }
+            }
+
+            table[k] = low;
+        }
+
+        table[0] = 1;
+
+        return table;
+    }();
+
+    if (length == 0) {
+        return -std::numeric_limits<float>::infinity();
+    }
+
+    auto bucket = std::upper_bound(thresholds.begin(), thresholds.end(), length) - 1;
+
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    return static_cast<float>(bucket - thresholds.begin()) / 10;
+}
+
+std::string floatPrecision(const float& v, const int& p) {
+    std::array<char, FLOAT_BUFFER_SIZE> buffer {};
+
+    auto [end, ec] = std::to_chars(buffer.begin(), buffer.end(), v, std::chars_format::fixed, p);
+
+    return { buffer.begin(), end };
+}
+
+std::string floatString(const float& v) {
+    std::array<char, FLOAT_BUFFER_SIZE> buffer {};
+
+    // Same as the default stream formatting: %g with 6 significant digits
+    auto [end, ec] = std::to_chars(buffer.begin(), buffer.end(), v, std::chars_format::general, 6);
+
+    return { buffer.begin(), end };
+}
@@ -0,0 +1,451 @@
+/**
+ * @file hnsw.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the HNSW graph, an approximate nearest neighbours index of fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <cmath>
+#include <finger/hnsw.hpp>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Marks the absence of an entry point
+ */
+static constexpr std::uint32_t NO_NODE = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * @brief Highest layer of a fingerprint, reached with a probability of m^-32
+ */
+static constexpr int MAX_LEVEL = 32;
+
+struct HNSWIndex::Node {
+    Node(std::string fingerprint, const FeatureTypes& mode)
+    : text(std::move(fingerprint)), fp(text, mode) { }
+
+    std::string text;
+    Fingerprint fp;
+
+    // IDs of the linked fingerprints on each layer the fingerprint is on, guarded by lock
+    std::vector<std::vector<std::uint32_t>> links;
+    std::mutex lock;
+};
+
+struct HNSWIndex::Candidate {
+    double distance;
+    std::uint32_t id;
+
+    bool operator<(const Candidate& other) const {
+        return distance < other.distance || (distance == other.distance && id < other.id);
+    }
+
+    bool operator>(const Candidate& other) const { return other < *this; }
+};
+
+namespace {
+
+/**
+ * @brief Fingerprints already reached by the search of the calling thread
+ *
+ * Marks are stamped with the number of the search, so that clearing them between two searches is
+ * free.
+ */
+class VisitedSet {
+  public:
+    void reset(std::size_t size) {
+        if (_marks.size() < size) {
+            _marks.resize(size, 0);
+        }
+
+        if (++_stamp == 0) {
+            std::fill(_marks.begin(), _marks.end(), 0);
+            _stamp = 1;
+        }
+    }
+
+    /**
+     * @brief Marks the fingerprint, returns false if it already was
+     */
+    bool visit(std::uint32_t id) {
+        if (_marks[id] == _stamp) {
+            return false;
+        }
+
+        _marks[id] = _stamp;
+
+        return true;
+    }
+
+  private:
+    std::vector<std::uint32_t> _marks;
+    std::uint32_t _stamp = 0;
+};
+
+thread_local VisitedSet visited;
+
+} // namespace
+
+//--------------------------------------------------------------------------------------//
+//                                        Graph                                         //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Throws if the parameters are out of bounds, before anything is allocated
+ */
+static const HNSWParams& checkParams(const HNSWParams& params) {
+    if (params.m < 2) {
+        throw std::invalid_argument("HNSWIndex: m must be at least 2");
+    }
+
+    return params;
+}
+
+/**
+ * @brief Throws if the ids of the capacity do not fit in 32 bits, before the nodes are allocated
+ */
+static std::size_t checkCapacity(std::size_t capacity) {
+    if (capacity >= NO_NODE) {
+        throw std::invalid_argument("HNSWIndex: capacity too large");
+    }
+
+    return capacity;
+}
+
+HNSWIndex::HNSWIndex(const FeatureTypes& mode, std::size_t capacity, const HNSWParams& params)
+: _mode(mode), _params(checkParams(params)), _nodes(checkCapacity(capacity)), _entry(NO_NODE) {
+    _levelScale = 1 / std::log(static_cast<double>(params.m));
+}
+
+HNSWIndex::~HNSWIndex() = default;
+
+const std::string& HNSWIndex::text(std::size_t id) const { return _nodes[id]->text; }
+
+const Fingerprint& HNSWIndex::fingerprint(std::uint32_t id) const { return _nodes[id]->fp; }
+
+std::size_t HNSWIndex::maxLinks(int level) const {
+    return level == 0 ? 2 * _params.m : _params.m;
+}
+
+/**
+ * @brief Draws the layer of a fingerprint, with an exponentially decaying probability
+ *
+ * The draw only depends on the seed and the ID, so that a graph built on one thread is the same
+ * for a given seed.
+ */
+int HNSWIndex::drawLevel(std::size_t id) const {
+    // splitmix64
+    std::uint64_t x = _params.seed + (id + 1) * 0x9E3779B97F4A7C15ULL; // NOLINT
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;                      // NOLINT
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;                      // NOLINT
+    x ^= x >> 31U;                                                      // NOLINT
+
+    // Uniform in (0, 1]
+    double u = static_cast<double>((x >> 11U) + 1) * 0x1.0p-53; // NOLINT
+
+    return std::min(static_cast<int>(-std::log(u) * _levelScale), MAX_LEVEL);
+}
+
+/**
+ * @brief Beam search of a layer: explores the links of the closest candidates until the ef
+ * closest fingerprints found can no longer be improved
+ *
+ * @return std::vector<Candidate> Up to ef fingerprints, sorted by distance
+ */
+std::vector<HNSWIndex::Candidate> HNSWIndex::searchLayer(const Fingerprint& query,
+                                                         const std::vector<Candidate>& entries,
+                                                         std::size_t ef, int level) const {
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> candidates;
+    std::priority_queue<Candidate> found;
+    std::vector<std::uint32_t> links;
+
+    visited.reset(_nodes.size());
+
+    for (const Candidate& entry: entries) {
+        visited.visit(entry.id);
+        candidates.push(entry);
+        found.push(entry);
+    }
+
+    while (found.size() > ef) {
+        found.pop();
+    }
+
+    while (!candidates.empty()) {
+        Candidate closest = candidates.top();
+        candidates.pop();
+
+        if (found.size() >= ef && closest.distance > found.top().distance) {
+            break;
+        }
+
+        {
+            Node& node = *_nodes[closest.id];
+            std::lock_guard<std::mutex> guard(node.lock);
+            links = node.links[level];
+        }
+
+        for (std::uint32_t id: links) {
+            if (!visited.visit(id)) {
+                continue;
+            }
+
+            Candidate next { distance(query, fingerprint(id), _mode), id };
+
+            if (found.size() < ef || next < found.top()) {
+                candidates.push(next);
+                found.push(next);
+
+                if (found.size() > ef) {
+                    found.pop();
+                }
+            }
+        }
+    }
+
+    std::vector<Candidate> result(found.size());
+
+    for (std::size_t i = result.size(); i > 0; i--) {
+        result[i - 1] = found.top();
+        found.pop();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Keeps up to m candidates, skipping those closer to an already kept one than to the base
+ * fingerprint, so that the links point in different directions
+ *
+ * @param candidates Candidates, sorted by distance to the base fingerprint
+ */
+std::vector<HNSWIndex::Candidate>
+HNSWIndex::selectNeighbors(const std::vector<Candidate>& candidates, std::size_t m) const {
+    std::vector<Candidate> selected;
+
+    for (const Candidate& candidate: candidates) {
+        if (selected.size() >= m) {
+            break;
+        }
+
+        bool diverse = std::all_of(selected.begin(), selected.end(), [&](const Candidate& kept) {
+            return distance(fingerprint(candidate.id), fingerprint(kept.id), _mode) >=
+                   candidate.distance;
+        });
+
+        if (diverse) {
+            selected.push_back(candidate);
+        }
+    }
+
+    return selected;
+}
+
+/**
+ * @brief Links a fingerprint to another one, pruning the links of the first one when it has too
+ * many
+ */
+void HNSWIndex::connect(std::uint32_t from, std::uint32_t to, int level) {
+    Node& node = *_nodes[from];
+    std::lock_guard<std::mutex> guard(node.lock);
+    std::vector<std::uint32_t>& links = node.links[level];
+
+    if (links.size() < maxLinks(level)) {
+        links.push_back(to);
+        return;
+    }
+
+    std::vector<Candidate> candidates;
+
+    for (std::uint32_t id: links) {
+        candidates.push_back({ distance(node.fp, fingerprint(id), _mode), id });
+    }
+
+    candidates.push_back({ distance(node.fp, fingerprint(to), _mode), to });
+    std::sort(candidates.begin(), candidates.end());
+
+    links.clear();
+
+    for (const Candidate& kept: selectNeighbors(candidates, maxLinks(level))) {
+        links.push_back(kept.id);
+    }
+}
+
+std::size_t HNSWIndex::add(std::string fingerprint) {
+    // Parsed first, a fingerprint not matching the mode takes no ID
+    auto node = std::make_unique<Node>(std::move(fingerprint), _mode);
+    std::size_t id = _count.load();
+
+    do {
+        if (id >= _nodes.size()) {
+            throw std::length_error("HNSWIndex: index full");
+        }
+    } while (!_count.compare_exchange_weak(id, id + 1));
+
+    int level = drawLevel(id);
+    auto self = static_cast<std::uint32_t>(id);
+    const Fingerprint& fp = node->fp;
+
+    node->links.resize(level + 1);
+    _nodes[id] = std::move(node);
+
+    std::uint32_t entry;
+    int top;
+
+    {
+        std::lock_guard<std::mutex> guard(_entryLock);
+        entry = _entry;
+        top = _topLevel;
+
+        if (entry == NO_NODE) {
+            _entry = self;
+            _topLevel = level;
+            return id;
+        }
+    }
+
+    // The fingerprints raising the top layer are linked one at a time, the entry point only
+    // changes once one is linked: queries keep reading it meanwhile
+    std::unique_lock<std::mutex> raise_lock(_raiseLock, std::defer_lock);
+
+    if (level > top) {
+        raise_lock.lock();
+
+        // Another fingerprint may have raised the top layer while waiting
+        {
+            std::lock_guard<std::mutex> guard(_entryLock);
+            entry = _entry;
+            top = _topLevel;
+        }
+
+        if (level <= top) {
+            raise_lock.unlock();
+        }
+    }
+
+    std::vector<Candidate> entries { { distance(fp, this->fingerprint(entry), _mode), entry } };
+
+    for (int l = top; l > level; l--) {
+        entries = searchLayer(fp, entries, 1, l);
+    }
+
+    for (int l = std::min(level, top); l >= 0; l--) {
+        std::vector<Candidate> found = searchLayer(fp, entries, _params.ef_construction, l);
+
+        // Fingerprints added meanwhile may already link to this one
+        std::erase_if(found, [self](const Candidate& c) { return c.id == self; });
+
+        std::vector<Candidate> neighbors = selectNeighbors(found, _params.m);
+
+        {
+            std::lock_guard<std::mutex> guard(_nodes[id]->lock);
+
+            for (const Candidate& neighbor: neighbors) {
+                _nodes[id]->links[l].push_back(neighbor.id);
+            }
+        }
+
+        for (const Candidate& neighbor: neighbors) {
+            connect(neighbor.id, self, l);
+        }
+
+        if (!found.empty()) {
+            entries = std::move(found);
+        }
+    }
+
+    if (raise_lock.owns_lock()) {
+        std::lock_guard<std::mutex> guard(_entryLock);
+        _entry = self;
+        _topLevel = level;
+    }
+
+    return id;
+}
+
+//--------------------------------------------------------------------------------------//
+//                                        Search                                        //
+//--------------------------------------------------------------------------------------//
+
+std::vector<TableMatch> HNSWIndex::knn(const Fingerprint& query, std::size_t k,
+                                       std::size_t ef) const {
+    std::uint32_t entry;
+    int top;
+
+    {
+        std::lock_guard<std::mutex> guard(_entryLock);
+        entry = _entry;
+        top = _topLevel;
+    }
+
+    if (entry == NO_NODE || k == 0) {
+        return {};
+    }
+
+    std::vector<Candidate> entries { { distance(query, fingerprint(entry), _mode), entry } };
+
+    for (int l = top; l > 0; l--) {
+        entries = searchLayer(query, entries, 1, l);
+    }
+
+    if (ef == 0) {
+        ef = _params.ef_search;
+    }
+
+    entries = searchLayer(query, entries, std::max(ef, k), 0);
+
+    std::vector<TableMatch> matches;
+
+    for (std::size_t i = 0; i < std::min(k, entries.size()); i++) {
+        matches.push_back({ entries[i].id, entries[i].distance });
+    }
+
+    return matches;
+}
+
+std::vector<std::vector<TableMatch>> HNSWIndex::knn(std::span<const Fingerprint> queries,
+                                                    std::size_t k, std::size_t ef,
+                                                    std::size_t threads) const {
+    std::vector<std::vector<TableMatch>> matches(queries.size());
+    std::atomic<std::size_t> next = 0;
+    std::exception_ptr error;
+    std::mutex error_lock;
+
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    // Queries are handed one by one, as their cost varies
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < queries.size(); i = next++) {
+            try {
+                matches[i] = knn(queries[i], k, ef);
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(error_lock);
+                error = std::current_exception();
+                next = queries.size();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (std::size_t t = 1; t < std::min(threads, queries.size()); t++) {
+        workers.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread& t: workers) {
+        t.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    return matches;
+}
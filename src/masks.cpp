@@ -0,0 +1,140 @@
+/**
+ * @file masks.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the bitmasks of the known headers and values of a request
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <finger/fingerprint.hpp>
+#include <finger/masks.hpp>
+
+HeaderMasks header_masks(const std::vector<std::string>& headers) {
+    std::vector<HeaderView> views;
+    views.reserve(headers.size());
+
+    for (const std::string& header: headers) {
+        views.emplace_back(splitHeaderLine(header));
+    }
+
+    return encodeHeaderMasks(views);
+}
+
+HeaderMasks orderMasks(std::string_view order) {
+    ConfigGuard config;
+    HeaderMasks masks;
+    std::size_t bits = std::min(config->header_codes.size(), HEADER_MASK_BITS);
+
+    while (!order.empty()) {
+        std::size_t end = std::min(order.find(','), order.size());
+        std::string_view code = order.substr(0, end);
+        bool uppercase = !code.starts_with('!');
+
+        if (!uppercase) {
+            code.remove_prefix(1);
+        }
+
+        // Unknown headers are hashes, which are not in the table
+        std::size_t known = config->header_codes.index(code);
+
+        if (known < bits) {
+            std::uint64_t bit = std::uint64_t(1) << known;
+
+            masks.presence |= bit;
+            masks.uppercase |= uppercase ? bit : 0;
+        }
+
+        order.remove_prefix(std::min(end + 1, order.size()));
+    }
+
+    return masks;
+}
+
+ValueBits value_bits(const std::vector<std::string>& headers) {
+    std::vector<HeaderView> views;
+    views.reserve(headers.size());
+
+    for (const std::string& header: headers) {
+        views.emplace_back(splitHeaderLine(header));
+    }
+
+    return encodeValueBits(views);
+}
+
+/**
+ * @brief Bit of a token code in a value table, 0 if the code is not in its first VALUE_TOKEN_BITS
+ * tokens
+ */
+static std::uint16_t codeBit(FrozenMapView table, std::string_view code) {
+    for (std::size_t j = 0; j < std::min(table.size(), VALUE_TOKEN_BITS); j++) {
+        if (table.begin()[j].value == code) {
+            return static_cast<std::uint16_t>(1U << j);
+        }
+    }
+
+    return 0;
+}
+
+ValueBits valuesBits(std::string_view values) {
+    ConfigGuard config;
+    ValueBits bits;
+
+    while (!values.empty()) {
+        std::size_t end = std::min(values.find('/'), values.size());
+        std::string_view entry = values.substr(0, end);
+        std::size_t colon = entry.find(':');
+
+        // Entries without a ':' are the rest of a value holding a '/'
+        if (colon != std::string_view::npos) {
+            std::string_view name = config->header_codes.find(entry.substr(0, colon));
+            auto header = std::find(VALUE_HEADERS.begin(), VALUE_HEADERS.end(), name);
+
+            if (!name.empty() && header != VALUE_HEADERS.end()) {
+                auto h = static_cast<std::size_t>(header - VALUE_HEADERS.begin());
+                std::string_view codes = entry.substr(colon + 1);
+                std::uint16_t tokens = 0;
+                bool known = true;
+
+                while (known) {
+                    std::size_t comma = std::min(codes.find(','), codes.size());
+                    std::uint16_t bit = codeBit((*config).*VALUE_TABLES[h], codes.substr(0, comma));
+
+                    tokens |= bit;
+                    known = bit != 0;
+
+                    if (comma == codes.size()) {
+                        break;
+                    }
+
+                    codes.remove_prefix(comma + 1);
+                }
+
+                bits.add(h, tokens, known);
+            }
+        }
+
+        values.remove_prefix(std::min(end + 1, values.size()));
+    }
+
+    return bits;
+}
+
+double valueSimilarity(const ValueBits& a, const ValueBits& b) {
+    double total = 0;
+    std::size_t count = 0;
+
+    for (std::size_t h = 0; h < VALUE_HEADER_COUNT; h++) {
+        unsigned bit = 1U << h;
+        bool known_a = (a.known & bit) != 0;
+        bool known_b = (b.known & bit) != 0;
+
+        if (known_a && known_b) {
+            total += maskJaccard(a.bits[h], b.bits[h]);
+            count++;
+        } else if (known_a || known_b || ((a.unknown ^ b.unknown) & bit) != 0) {
+            count++;
+        }
+    }
+
+    return count == 0 ? 1. : total / static_cast<double>(count);
+}
@@ -0,0 +1,223 @@
+/**
+ * @file minhash.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the MinHash signatures of the header tokens and of their LSH index
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <cmath>
+#include <finger/fingerprint.hpp>
+#include <finger/minhash.hpp>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief Features of a header fingerprint, as header_fingerprint() gives it
+ */
+static constexpr FeatureTypes HEADER_FEATURES = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 's', 's', 0, 0, 0 };
+
+/**
+ * @brief Seed of the hash functions of the signatures
+ */
+static constexpr std::uint64_t MINHASH_SEED = 0x2545F4914F6CDD1DULL;
+
+/**
+ * @brief splitmix64 finalizer
+ */
+static std::uint64_t mix(std::uint64_t x) {
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL; // NOLINT(readability-magic-numbers)
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL; // NOLINT(readability-magic-numbers)
+
+    return x ^ (x >> 31U); // NOLINT(readability-magic-numbers)
+}
+
+//--------------------------------------------------------------------------------------//
+//                                      Signatures                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Spreads a 32 bits token of a feature over 64 bits
+ */
+static std::uint64_t tokenHash(std::uint64_t salt, std::uint32_t token) {
+    return mix((salt << 32U) ^ token ^ 0x9E3779B97F4A7C15ULL); // NOLINT(readability-magic-numbers)
+}
+
+std::vector<std::uint64_t> headerTokens(const Fingerprint& fp) {
+    std::vector<std::uint64_t> tokens;
+    tokens.reserve(fp.headerOrder().size() + fp.headerValues().size());
+
+    for (std::uint32_t name: fp.headerOrder()) {
+        tokens.push_back(tokenHash(FEATURE_HEADER_ORDER, name));
+    }
+
+    for (std::uint32_t value: fp.headerValues()) {
+        tokens.push_back(tokenHash(FEATURE_HEADER_VALUES, value));
+    }
+
+    std::sort(tokens.begin(), tokens.end());
+    tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+
+    return tokens;
+}
+
+std::vector<std::uint64_t> header_tokens(const std::vector<std::string>& headers) {
+    return headerTokens(Fingerprint(header_fingerprint(headers), HEADER_FEATURES));
+}
+
+std::vector<std::uint32_t> minhash(std::span<const std::uint64_t> tokens, std::size_t hashes) {
+    // Hash i is the high half of a * x + b: multiply-shift, over tokens already mixed
+    std::vector<std::uint64_t> a(hashes);
+    std::vector<std::uint64_t> b(hashes);
+
+    for (std::size_t i = 0; i < hashes; i++) {
+        a[i] = mix(MINHASH_SEED + 2 * i) | 1U;
+        b[i] = mix(MINHASH_SEED + 2 * i + 1);
+    }
+
+    std::vector<std::uint32_t> signature(hashes, std::numeric_limits<std::uint32_t>::max());
+
+    // One token at a time, the hashes being independent lanes
+    for (std::uint64_t token: tokens) {
+        for (std::size_t i = 0; i < hashes; i++) {
+            auto h = static_cast<std::uint32_t>((a[i] * token + b[i]) >> 32U);
+            signature[i] = std::min(signature[i], h);
+        }
+    }
+
+    return signature;
+}
+
+double minhashSimilarity(std::span<const std::uint32_t> a, std::span<const std::uint32_t> b) {
+    std::size_t hashes = std::min(a.size(), b.size());
+    std::size_t equal = 0;
+
+    if (hashes == 0) {
+        return 1;
+    }
+
+    for (std::size_t i = 0; i < hashes; i++) {
+        equal += a[i] == b[i] ? 1 : 0;
+    }
+
+    return static_cast<double>(equal) / static_cast<double>(hashes);
+}
+
+//--------------------------------------------------------------------------------------//
+//                                        Index                                         //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Throws if the threshold is not in ]0, 1]
+ */
+static void checkThreshold(double threshold) {
+    if (!(threshold > 0 && threshold <= 1)) {
+        throw std::invalid_argument("MinHashIndex: threshold must be in ]0, 1]");
+    }
+}
+
+/**
+ * @brief Hashes per band whose S-curve rises at the threshold or just below it, so that the
+ * signatures above the threshold are rarely missed
+ */
+static std::size_t bandRows(double threshold, std::size_t hashes) {
+    std::size_t best = 1;
+
+    for (std::size_t rows = 1; rows <= hashes; rows++) {
+        auto bands = static_cast<double>(hashes / rows);
+
+        if (std::pow(1 / bands, 1 / static_cast<double>(rows)) <= threshold) {
+            best = rows;
+        }
+    }
+
+    return best;
+}
+
+MinHashIndex::MinHashIndex(double threshold, std::size_t hashes)
+: MinHashIndex(threshold, hashes == 0 ? 0 : hashes / bandRows(threshold, hashes),
+               hashes == 0 ? 0 : bandRows(threshold, hashes)) {}
+
+MinHashIndex::MinHashIndex(double threshold, std::size_t bands, std::size_t rows)
+: _threshold(threshold), _rows(rows), _buckets(bands) {
+    checkThreshold(threshold);
+
+    if (bands == 0 || rows == 0) {
+        throw std::invalid_argument("MinHashIndex: bands and rows must be positive");
+    }
+}
+
+std::span<const std::uint32_t> MinHashIndex::signature(std::size_t row) const {
+    return std::span<const std::uint32_t>(_signatures).subspan(row * hashes(), hashes());
+}
+
+std::uint64_t MinHashIndex::bandHash(std::span<const std::uint32_t> signature,
+                                     std::size_t band) const {
+    std::uint64_t hash = band;
+
+    for (std::uint32_t h: signature.subspan(band * _rows, _rows)) {
+        hash = mix(hash ^ h) + 0x9E3779B97F4A7C15ULL; // NOLINT(readability-magic-numbers)
+    }
+
+    return hash;
+}
+
+std::size_t MinHashIndex::add(std::span<const std::uint32_t> signature) {
+    if (signature.size() < hashes()) {
+        throw std::invalid_argument("MinHashIndex: signature shorter than the bands");
+    }
+
+    std::size_t row = size();
+
+    if (row >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("MinHashIndex: too many signatures");
+    }
+
+    _signatures.insert(_signatures.end(), signature.begin(), signature.begin() + hashes());
+
+    for (std::size_t band = 0; band < bands(); band++) {
+        _buckets[band][bandHash(signature, band)].push_back(static_cast<std::uint32_t>(row));
+    }
+
+    return row;
+}
+
+std::vector<std::size_t> MinHashIndex::candidates(std::span<const std::uint32_t> query) const {
+    if (query.size() < hashes()) {
+        throw std::invalid_argument("MinHashIndex: signature shorter than the bands");
+    }
+
+    std::vector<std::size_t> rows;
+
+    for (std::size_t band = 0; band < bands(); band++) {
+        auto bucket = _buckets[band].find(bandHash(query, band));
+
+        if (bucket != _buckets[band].end()) {
+            rows.insert(rows.end(), bucket->second.begin(), bucket->second.end());
+        }
+    }
+
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+    return rows;
+}
+
+std::vector<JaccardMatch> MinHashIndex::similar(std::span<const std::uint32_t> query) const {
+    std::vector<JaccardMatch> matches;
+
+    for (std::size_t row: candidates(query)) {
+        double similarity = minhashSimilarity(signature(row), query.first(hashes()));
+
+        if (similarity >= _threshold) {
+            matches.push_back({ row, similarity });
+        }
+    }
+
+    std::stable_sort(matches.begin(), matches.end(),
+                     [](const JaccardMatch& x, const JaccardMatch& y) {
+                         return x.similarity > y.similarity;
+                     });
+
+    return matches;
+}
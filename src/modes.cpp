@@ -0,0 +1,108 @@
+/**
+ * @file modes.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the fingerprints restricted to the features of a mode
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <finger/modes.hpp>
+
+/**
+ * @brief Formats a float feature of the URI: rounded to an integer for the 'i' type, with 1
+ * decimal otherwise
+ */
+static std::string uriFloat(float value, char type) {
+    return floatPrecision(value, type == 'i' ? 0 : 1);
+}
+
+/**
+ * @brief Formats a float feature of the payload: rounded to an integer for the 'i' type, as in the
+ * payload fingerprint otherwise
+ */
+static std::string payloadFloat(float value, char type) {
+    return type == 'i' ? floatPrecision(value, 0) : floatString(value);
+}
+
+std::string formatFeatures(const RequestFeatures& features, const FeatureTypes& mode) {
+    std::string fingerprint;
+    bool first = true;
+
+    for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+        char type = mode[i];
+
+        if (type == 0) {
+            continue;
+        }
+
+        if (!first) {
+            fingerprint += '|';
+        }
+
+        first = false;
+
+        switch (i) {
+        case FEATURE_URI_LENGTH:
+            fingerprint += uriFloat(features.uri_length, type);
+            break;
+        case FEATURE_DIRECTORY_COUNT:
+            if (features.uri_parsed) {
+                fingerprint += std::to_string(features.directories.count);
+            }
+            break;
+        case FEATURE_DIRECTORY_SIZE:
+            if (features.uri_parsed) {
+                fingerprint += uriFloat(features.directories.avg_size_log, type);
+            }
+            break;
+        case FEATURE_EXTENSION:
+            fingerprint += features.extension;
+            break;
+        case FEATURE_QUERY_SIZE:
+            if (features.has_query) {
+                fingerprint += uriFloat(features.query_size_log, type);
+            }
+            break;
+        case FEATURE_QUERY_COUNT:
+            if (features.has_query) {
+                fingerprint += std::to_string(features.query.count);
+            }
+            break;
+        case FEATURE_QUERY_VALUE_SIZE:
+            if (features.has_query) {
+                fingerprint += uriFloat(features.query.avg_size_log, type);
+            }
+            break;
+        case FEATURE_METHOD:
+            fingerprint += features.method;
+            break;
+        case FEATURE_VERSION:
+            fingerprint += features.version;
+            break;
+        case FEATURE_HEADER_ORDER:
+            fingerprint += features.header_order;
+            break;
+        case FEATURE_HEADER_VALUES:
+            fingerprint += features.header_values;
+            break;
+        case FEATURE_PAYLOAD:
+            if (features.has_payload) {
+                fingerprint += 'A';
+            }
+            break;
+        case FEATURE_PAYLOAD_ENTROPY:
+            if (features.has_payload) {
+                fingerprint += payloadFloat(features.payload_entropy, type);
+            }
+            break;
+        case FEATURE_PAYLOAD_LENGTH:
+            if (features.has_payload) {
+                fingerprint += payloadFloat(features.payload_length, type);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    return fingerprint;
+}
@@ -0,0 +1,360 @@
+/**
+ * @file payload.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the incremental payload fingerprinting
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <fcntl.h>
+#include <finger/payload.hpp>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+/**
+ * @brief SplitMix64 generator step, draws the positions of the sampled blocks
+ *
+ * @param state Generator state, updated
+ * @return std::uint64_t Next pseudo-random value
+ */
+static std::uint64_t splitmix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);  // NOLINT(readability-magic-numbers)
+    z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;        // NOLINT(readability-magic-numbers)
+    z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;        // NOLINT(readability-magic-numbers)
+
+    return z ^ (z >> 31U); // NOLINT(readability-magic-numbers)
+}
+
+//--------------------------------------------------------------------------------------//
+//                                  PayloadAccumulator                                  //
+//--------------------------------------------------------------------------------------//
+
+void PayloadAccumulator::update(std::string_view chunk) {
+    byteOccurrences(chunk, _counts);
+    _size += chunk.size();
+}
+
+void PayloadAccumulator::update(std::span<const std::byte> chunk) { update(bytesView(chunk)); }
+
+std::string PayloadAccumulator::finish() const {
+    if (_size == 0) {
+        return "||";
+    }
+
+    return formatPayloadFingerprint(histogramEntropy(_counts, _size), _size);
+}
+
+void PayloadAccumulator::reset() {
+    _counts = {};
+    _size = 0;
+}
+
+//--------------------------------------------------------------------------------------//
+//                                    ChunkedDecoder                                    //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Value of an hexadecimal digit
+ *
+ * @return int The value of the digit, -1 if the character is not an hexadecimal digit
+ */
+static int hexDigit(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10; // NOLINT(readability-magic-numbers)
+    }
+
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10; // NOLINT(readability-magic-numbers)
+    }
+
+    return -1;
+}
+
+std::size_t ChunkedDecoder::update(std::string_view data) {
+    std::size_t i = 0;
+
+    while (i < data.size() && _state != State::Done) {
+        char c = data[i];
+
+        switch (_state) {
+        case State::Size:
+            if (int digit = hexDigit(c); digit >= 0) {
+                if (_remaining > (UINT64_MAX >> 4U)) {
+                    throw std::invalid_argument("ChunkedDecoder: chunk size overflow");
+                }
+
+                _remaining = (_remaining << 4U) | static_cast<std::uint64_t>(digit);
+                _digits = true;
+            } else if (c == ';' || c == ' ' || c == '\t') {
+                _state = State::Extension;
+            } else if (c == '\r') {
+                _state = State::SizeLF;
+            } else if (c == '\n') {
+                endSizeLine();
+            } else {
+                throw std::invalid_argument("ChunkedDecoder: invalid chunk size");
+            }
+            break;
+
+        case State::Extension:
+            if (c == '\n') {
+                endSizeLine();
+            }
+            break;
+
+        case State::SizeLF:
+            if (c != '\n') {
+                throw std::invalid_argument("ChunkedDecoder: invalid chunk size line ending");
+            }
+            endSizeLine();
+            break;
+
+        case State::Data: {
+            std::size_t n = std::min<std::uint64_t>(_remaining, data.size() - i);
+
+            _sink.update(data.substr(i, n));
+            _remaining -= n;
+            i += n;
+
+            if (_remaining == 0) {
+                _state = State::DataCR;
+            }
+            continue;
+        }
+
+        case State::DataCR:
+        case State::DataLF:
+            if (c == '\n') {
+                _state = State::Size;
+                _digits = false;
+            } else if (c == '\r' && _state == State::DataCR) {
+                _state = State::DataLF;
+            } else {
+                throw std::invalid_argument("ChunkedDecoder: missing CRLF after chunk data");
+            }
+            break;
+
+        case State::Trailer:
+            if (c == '\n') {
+                _state = State::Done;
+            } else if (c != '\r') {
+                _state = State::TrailerLine;
+            }
+            break;
+
+        case State::TrailerLine:
+            if (c == '\n') {
+                _state = State::Trailer;
+            }
+            break;
+
+        case State::Done:
+            break;
+        }
+
+        i++;
+    }
+
+    return i;
+}
+
+std::size_t ChunkedDecoder::update(std::span<const std::byte> data) {
+    return update(bytesView(data));
+}
+
+void ChunkedDecoder::endSizeLine() {
+    if (!_digits) {
+        throw std::invalid_argument("ChunkedDecoder: missing chunk size");
+    }
+
+    _state = _remaining == 0 ? State::Trailer : State::Data;
+}
+
+void ChunkedDecoder::reset() {
+    _state = State::Size;
+    _remaining = 0;
+    _digits = false;
+}
+
+std::string chunked_payload_fingerprint(std::string_view body) {
+    // Single chunk fast path: "<size>\r\n<data>\r\n0\r\n\r\n"
+    static constexpr std::string_view LAST_CHUNK = "\r\n0\r\n\r\n";
+    std::uint64_t size = 0;
+    auto [end, ec] = std::from_chars(body.data(), body.data() + body.size(), size, 16);
+    std::string_view rest = body.substr(end - body.data());
+
+    if (ec == std::errc() && size > 0 && rest.substr(0, 2) == "\r\n" &&
+        rest.size() - 2 >= LAST_CHUNK.size() && rest.size() - 2 - LAST_CHUNK.size() == size &&
+        rest.substr(2 + size) == LAST_CHUNK) {
+        ByteHistogram counts {};
+
+        byteOccurrences(rest.substr(2, size), counts);
+
+        return formatPayloadFingerprint(histogramEntropy(counts, size), size);
+    }
+
+    PayloadAccumulator acc;
+    ChunkedDecoder decoder(acc);
+
+    decoder.update(body);
+
+    if (!decoder.done()) {
+        throw std::invalid_argument("chunked_payload_fingerprint: truncated chunked body");
+    }
+
+    return acc.finish();
+}
+
+std::string chunked_payload_fingerprint(std::span<const std::byte> body) {
+    return chunked_payload_fingerprint(bytesView(body));
+}
+
+//--------------------------------------------------------------------------------------//
+//                                      MappedFile                                      //
+//--------------------------------------------------------------------------------------//
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "MappedFile: " + path);
+    }
+
+    struct stat st {};
+
+    if (fstat(fd, &st) < 0) {
+        int err = errno;
+        close(fd);
+        throw std::system_error(err, std::generic_category(), "MappedFile: " + path);
+    }
+
+    // Nothing to map for an empty file, mmap does not accept a 0 length
+    if (st.st_size > 0) {
+        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED) { // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), "MappedFile: " + path);
+        }
+
+        // The whole file is usually scanned once, from the start
+        madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+        _data = static_cast<const std::byte*>(data);
+        _size = static_cast<std::size_t>(st.st_size);
+    }
+
+    // The mapping stays valid once the descriptor is closed
+    close(fd);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+: _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) { }
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        if (_data != nullptr) {
+            munmap(const_cast<std::byte*>(_data), _size); // NOLINT
+        }
+
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+    }
+
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    if (_data != nullptr) {
+        munmap(const_cast<std::byte*>(_data), _size); // NOLINT
+    }
+}
+
+std::string file_payload_fingerprint(const std::string& path) {
+    MappedFile file(path);
+
+    return payload_fingerprint(file.bytes());
+}
+
+std::string file_payload_fingerprint(const std::string& path, const EntropySampling& sampling) {
+    MappedFile file(path);
+
+    return payload_fingerprint(file.bytes(), sampling);
+}
+
+//--------------------------------------------------------------------------------------//
+//                                   Sampled entropy                                    //
+//--------------------------------------------------------------------------------------//
+
+std::string payload_fingerprint(std::string_view payload, const EntropySampling& sampling) {
+    if (payload.empty()) {
+        return "||";
+    }
+
+    return formatPayloadFingerprint(sampledEntropy(payload, sampling), payload.size());
+}
+
+std::string payload_fingerprint(std::span<const std::byte> payload) {
+    if (payload.empty()) {
+        return "||";
+    }
+
+    ByteHistogram counts {};
+
+    byteOccurrences(bytesView(payload), counts);
+
+    return formatPayloadFingerprint(histogramEntropy(counts, payload.size()), payload.size());
+}
+
+std::string payload_fingerprint(std::span<const std::byte> payload,
+                                const EntropySampling& sampling) {
+    return payload_fingerprint(bytesView(payload), sampling);
+}
+
+float sampledEntropy(std::string_view payload, const EntropySampling& sampling) {
+    if (sampling.sample_size == 0) {
+        throw std::invalid_argument("sampledEntropy: sample_size must be positive");
+    }
+
+    ByteHistogram counts {};
+
+    if (payload.size() <= sampling.threshold || payload.size() <= sampling.sample_size) {
+        byteOccurrences(payload, counts);
+
+        return histogramEntropy(counts, payload.size());
+    }
+
+    std::uint64_t block = std::clamp<std::uint64_t>(sampling.block_size, 1, sampling.sample_size);
+    std::uint64_t blocks = std::max<std::uint64_t>(sampling.sample_size / block, 1);
+    std::uint64_t stratum = payload.size() / blocks;
+    std::uint64_t state = sampling.seed;
+    std::uint64_t sampled = 0;
+
+    for (std::uint64_t b = 0; b < blocks; b++) {
+        std::uint64_t offset = b * stratum + splitmix64(state) % (stratum - block + 1);
+
+        byteOccurrences(payload.substr(offset, block), counts);
+        sampled += block;
+    }
+
+    return histogramEntropy(counts, sampled);
+}
+
+std::string formatPayloadFingerprint(float entropy, std::uint64_t length) {
+    if (length == 0) {
+        return "||";
+    }
+
+    return "A|" + floatString(entropy) + "|" + floatString(log10length(length));
+}
@@ -0,0 +1,251 @@
+/**
+ * @file simhash.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the SimHash signatures of fingerprints and of their Hamming search index
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <finger/simhash.hpp>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief Bits of a signature
+ */
+static constexpr unsigned SIGNATURE_BITS = 64;
+
+/**
+ * @brief Salt of the pairs of successive header names, told apart from the features
+ */
+static constexpr std::uint64_t PAIR_SALT = FEATURE_COUNT;
+
+//--------------------------------------------------------------------------------------//
+//                                      Signatures                                      //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Spreads a 32 bits token of a feature over 64 bits (splitmix64 finalizer)
+ */
+static std::uint64_t tokenHash(std::uint64_t salt, std::uint64_t token) {
+    std::uint64_t x = (salt << 32U) ^ token ^ 0x9E3779B97F4A7C15ULL; // NOLINT
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;                     // NOLINT
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;                     // NOLINT
+
+    return x ^ (x >> 31U); // NOLINT(readability-magic-numbers)
+}
+
+/**
+ * @brief Sums the bits of the token hashes, the majority of each bit gives the signature
+ */
+class BitVotes {
+  public:
+    void add(std::uint64_t hash) {
+        for (unsigned b = 0; b < SIGNATURE_BITS; b++) {
+            _ones[b] += static_cast<int>((hash >> b) & 1U);
+        }
+
+        _tokens++;
+    }
+
+    std::uint64_t signature() const {
+        std::uint64_t signature = 0;
+
+        for (unsigned b = 0; b < SIGNATURE_BITS; b++) {
+            if (2 * _ones[b] > _tokens) {
+                signature |= std::uint64_t(1) << b;
+            }
+        }
+
+        return signature;
+    }
+
+  private:
+    std::array<int, SIGNATURE_BITS> _ones {};
+    int _tokens = 0;
+};
+
+std::uint64_t simhash(const Fingerprint& fp) {
+    BitVotes votes;
+
+    for (std::size_t i = 0; i <= FEATURE_HEADER_VALUES; i++) {
+        const FingerprintField& field = fp.field(i);
+
+        if (fp.mode()[i] == 0 || field.empty) {
+            continue;
+        }
+
+        if (i == FEATURE_HEADER_ORDER) {
+            std::span<const std::uint32_t> order = fp.headerOrder();
+
+            for (std::size_t h = 0; h < order.size(); h++) {
+                votes.add(tokenHash(i, order[h]));
+
+                if (h > 0) {
+                    votes.add(tokenHash(PAIR_SALT, order[h - 1] * 0x9E3779B9ULL ^ order[h]));
+                }
+            }
+        } else if (i == FEATURE_HEADER_VALUES) {
+            for (std::uint32_t value: fp.headerValues()) {
+                votes.add(tokenHash(i, value));
+            }
+        } else if (fp.mode()[i] != 's' && field.numeric && std::isfinite(field.number)) {
+            // Close lengths and counts share a bucket
+            votes.add(tokenHash(i, static_cast<std::uint64_t>(std::llround(field.number))));
+        } else {
+            votes.add(tokenHash(i, field.hash));
+        }
+    }
+
+    return votes.signature();
+}
+
+std::uint64_t simhash(std::string_view fp, const FeatureTypes& mode) {
+    return simhash(Fingerprint(fp, mode));
+}
+
+//--------------------------------------------------------------------------------------//
+//                                        Index                                         //
+//--------------------------------------------------------------------------------------//
+
+std::uint64_t SimHashIndex::Block::value(std::uint64_t signature) const {
+    std::uint64_t mask = width == SIGNATURE_BITS ? ~std::uint64_t(0)
+                                                 : (std::uint64_t(1) << width) - 1;
+
+    return (signature >> shift) & mask;
+}
+
+/**
+ * @brief Entry of the directory of a block value, from its high bits
+ */
+static std::size_t directoryEntry(std::uint64_t value, unsigned width, unsigned bits) {
+    return bits == 0 ? 0 : static_cast<std::size_t>(value >> (width - bits));
+}
+
+SimHashIndex::SimHashIndex(std::vector<std::uint64_t> signatures, int k)
+: _signatures(std::move(signatures)), _k(k) {
+    if (k < 0 || k >= static_cast<int>(SIGNATURE_BITS)) {
+        throw std::invalid_argument("SimHashIndex: k must be between 0 and 63");
+    }
+
+    if (_signatures.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("SimHashIndex: too many signatures");
+    }
+
+    // Blocks of about log2(n) bits, at most k + 1 of them to look up a single value per block for
+    // a radius of k. The first blocks are one bit wider when 64 is not a multiple of their count.
+    auto bits = std::max(static_cast<unsigned>(std::bit_width(_signatures.size())), 1U);
+    unsigned count = std::clamp(SIGNATURE_BITS / bits, 1U, static_cast<unsigned>(k + 1));
+    unsigned shift = 0;
+
+    for (unsigned b = 0; b < count; b++) {
+        Block block;
+        block.shift = shift;
+        block.width = SIGNATURE_BITS / count + (b < SIGNATURE_BITS % count ? 1 : 0);
+        // 2^(bit_width(n) - 1) entries, at most n + 1 with the end of the last one
+        block.directoryBits = std::min(block.width, bits - 1);
+        shift += block.width;
+
+        block.rows.resize(_signatures.size());
+
+        for (std::size_t r = 0; r < block.rows.size(); r++) {
+            block.rows[r] = static_cast<std::uint32_t>(r);
+        }
+
+        std::sort(block.rows.begin(), block.rows.end(), [&](std::uint32_t x, std::uint32_t y) {
+            std::uint64_t vx = block.value(_signatures[x]);
+            std::uint64_t vy = block.value(_signatures[y]);
+
+            return vx < vy || (vx == vy && x < y);
+        });
+
+        // directory[e] is the first row whose value falls in the entry e or after
+        block.directory.assign((std::size_t(1) << block.directoryBits) + 1, 0);
+
+        for (std::uint32_t row: block.rows) {
+            std::uint64_t value = block.value(_signatures[row]);
+            block.directory[directoryEntry(value, block.width, block.directoryBits) + 1]++;
+        }
+
+        for (std::size_t e = 1; e < block.directory.size(); e++) {
+            block.directory[e] += block.directory[e - 1];
+        }
+
+        _blocks.push_back(std::move(block));
+    }
+}
+
+/**
+ * @brief Calls f on every value of width bits within radius bits of the given one, flipping the
+ * bits from the given one
+ */
+template<typename F>
+static void forEachWithin(std::uint64_t value, unsigned width, int radius, unsigned from, F& f) {
+    f(value);
+
+    if (radius == 0) {
+        return;
+    }
+
+    for (unsigned bit = from; bit < width; bit++) {
+        forEachWithin(value ^ (std::uint64_t(1) << bit), width, radius - 1, bit + 1, f);
+    }
+}
+
+std::vector<HammingMatch> SimHashIndex::within(std::uint64_t query, int radius) const {
+    if (radius < 0) {
+        radius = _k;
+    }
+
+    if (radius > _k) {
+        throw std::invalid_argument("SimHashIndex: radius greater than k");
+    }
+
+    std::vector<HammingMatch> matches;
+    int probe = radius / static_cast<int>(_blocks.size());
+
+    // Whether the block of a signature is within the probed bits of the query
+    auto probed = [&](const Block& block, std::uint64_t signature) {
+        return std::popcount(block.value(signature) ^ block.value(query)) <= probe;
+    };
+
+    for (std::size_t b = 0; b < _blocks.size(); b++) {
+        const Block& block = _blocks[b];
+
+        auto lookup = [&](std::uint64_t value) {
+            std::size_t entry = directoryEntry(value, block.width, block.directoryBits);
+            auto first = block.rows.begin() + block.directory[entry];
+            auto last = block.rows.begin() + block.directory[entry + 1];
+
+            // Within an entry, the rows are sorted by the value of the block
+            first = std::partition_point(first, last, [&](std::uint32_t row) {
+                return block.value(_signatures[row]) < value;
+            });
+
+            for (; first != last && block.value(_signatures[*first]) == value; first++) {
+                std::uint64_t signature = _signatures[*first];
+                int distance = std::popcount(signature ^ query);
+
+                // Found once, from the first block probed
+                bool seen =
+                std::any_of(_blocks.begin(), _blocks.begin() + b,
+                            [&](const Block& other) { return probed(other, signature); });
+
+                if (!seen && distance <= radius) {
+                    matches.push_back({ *first, distance });
+                }
+            }
+        };
+
+        forEachWithin(block.value(query), block.width, probe, 0, lookup);
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const HammingMatch& x, const HammingMatch& y) {
+        return x.distance < y.distance || (x.distance == y.distance && x.row < y.row);
+    });
+
+    return matches;
+}
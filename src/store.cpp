@@ -0,0 +1,573 @@
+/**
+ * @file store.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the column-wise store of reference fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <finger/store.hpp>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define FINGER_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Rows compared per block, the distances of a block stay in L1
+ */
+static constexpr std::size_t BLOCK_ROWS = 512;
+
+/**
+ * @brief Rows read ahead of the current one in each column
+ */
+static constexpr std::size_t PREFETCH_ROWS = 256;
+
+/**
+ * @brief Boxed value of an empty numeric feature, a quiet NaN
+ */
+static constexpr std::uint32_t EMPTY_NUMBER = 0x7FC00000U;
+
+/**
+ * @brief Payload bits of the NaNs boxing non numeric values
+ */
+static constexpr std::uint32_t NAN_PAYLOAD = 0x3FFFFFU;
+
+/**
+ * @brief ID of the query strings absent from the table, never matches a row
+ */
+static constexpr std::uint32_t UNKNOWN_ID = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * @brief Multiplier spreading the token hashes before their top 6 bits pick a mask bit (Fibonacci
+ * hashing)
+ */
+static constexpr std::uint64_t MASK_MIX = 0x9E3779B97F4A7C15ULL;
+static constexpr unsigned MASK_SHIFT = 58;
+
+//--------------------------------------------------------------------------------------//
+//                                       Columns                                        //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Quantizes a numeric feature: numbers as floats, empty and non numeric values (compared by
+ * their hash) boxed in NaNs, which only compare equal bit for bit
+ */
+static float quantize(const FingerprintField& field) {
+    if (field.numeric) {
+        return static_cast<float>(field.number);
+    }
+
+    std::uint32_t payload = field.empty ? 0 : 1 + field.hash % NAN_PAYLOAD;
+
+    return std::bit_cast<float>(EMPTY_NUMBER | payload);
+}
+
+/**
+ * @brief Mask of the hashed tokens of a header list, one bit per token
+ */
+static std::uint64_t tokenMask(std::span<const std::uint32_t> tokens) {
+    std::uint64_t mask = 0;
+
+    for (std::uint32_t token: tokens) {
+        mask |= std::uint64_t(1) << ((token * MASK_MIX) >> MASK_SHIFT);
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Checks that the fingerprint holds every feature of the mode
+ */
+static void checkFeatures(const Fingerprint& fp, const FeatureTypes& mode, const char* what) {
+    for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+        if (mode[i] != 0 && fp.mode()[i] == 0) {
+            throw std::invalid_argument(std::string("FingerprintTable: feature not in the ") +
+                                        what);
+        }
+    }
+}
+
+FingerprintTable::FingerprintTable(const FeatureTypes& mode)
+    : _mode(mode), _order(mode[FEATURE_HEADER_ORDER] != 0),
+      _values(mode[FEATURE_HEADER_VALUES] != 0), _count(0), _orderOffsets { 0 },
+      _valuesOffsets { 0 } {
+    for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+        if (mode[i] == 0 || i == FEATURE_HEADER_ORDER || i == FEATURE_HEADER_VALUES) {
+            continue;
+        }
+
+        if (mode[i] == 's') {
+            _stringFeatures.push_back(i);
+        } else {
+            _numericFeatures.push_back(i);
+        }
+    }
+
+    _numeric.resize(_numericFeatures.size());
+    _strings.resize(_stringFeatures.size());
+    _count = _numericFeatures.size() + _stringFeatures.size() + (_order ? 1 : 0) +
+             (_values ? 1 : 0);
+}
+
+void FingerprintTable::reserve(std::size_t rows) {
+    for (auto& column: _numeric) {
+        column.reserve(rows);
+    }
+
+    for (auto& column: _strings) {
+        column.reserve(rows);
+    }
+
+    if (_order) {
+        _orderMasks.reserve(rows);
+        _orderOffsets.reserve(rows + 1);
+    }
+
+    if (_values) {
+        _valuesMasks.reserve(rows);
+        _valuesOffsets.reserve(rows + 1);
+    }
+}
+
+std::size_t FingerprintTable::add(const Fingerprint& fp) {
+    checkFeatures(fp, _mode, "fingerprint");
+
+    for (std::size_t c = 0; c < _numericFeatures.size(); c++) {
+        _numeric[c].push_back(quantize(fp.field(_numericFeatures[c])));
+    }
+
+    for (std::size_t c = 0; c < _stringFeatures.size(); c++) {
+        std::uint32_t hash = fp.field(_stringFeatures[c]).hash;
+        auto id = _ids.try_emplace(hash, static_cast<std::uint32_t>(_ids.size())).first->second;
+
+        _strings[c].push_back(id);
+    }
+
+    if (_order) {
+        _orderMasks.push_back(tokenMask(fp.headerOrder()));
+        _orderTokens.insert(_orderTokens.end(), fp.headerOrder().begin(), fp.headerOrder().end());
+        _orderOffsets.push_back(static_cast<std::uint32_t>(_orderTokens.size()));
+    }
+
+    if (_values) {
+        _valuesMasks.push_back(tokenMask(fp.headerValues()));
+        _valuesTokens.insert(
+        _valuesTokens.end(), fp.headerValues().begin(), fp.headerValues().end());
+        _valuesOffsets.push_back(static_cast<std::uint32_t>(_valuesTokens.size()));
+    }
+
+    return _rows++;
+}
+
+//--------------------------------------------------------------------------------------//
+//                                       Kernels                                        //
+//--------------------------------------------------------------------------------------//
+
+namespace {
+
+/**
+ * @brief Numeric and string columns of the table and their query values
+ */
+struct ColumnsView {
+    std::size_t rows;
+
+    const float* const* numeric;
+    const float* query_numeric;
+    std::size_t numeric_count;
+
+    const std::uint32_t* const* strings;
+    const std::uint32_t* query_strings;
+    std::size_t string_count;
+};
+
+/**
+ * @brief Sums the distances of the numeric and string columns of the rows [begin, begin + n)
+ */
+using ColumnKernel = void (*)(const ColumnsView&, std::size_t begin, std::size_t n, float* sums);
+
+/**
+ * @brief Distance between two quantized numeric features, as in distance()
+ */
+float numberDistance(float a, float b) {
+    if (std::bit_cast<std::uint32_t>(a) == std::bit_cast<std::uint32_t>(b)) {
+        return 0;
+    }
+
+    if (!std::isfinite(a) || !std::isfinite(b)) {
+        return 1;
+    }
+
+    return std::min(std::fabs(a - b) / std::max({ std::fabs(a), std::fabs(b), 1.F }), 1.F);
+}
+
+void scalarKernel(const ColumnsView& view, std::size_t begin, std::size_t n, float* sums) {
+    std::fill(sums, sums + n, 0.F);
+
+    for (std::size_t c = 0; c < view.numeric_count; c++) {
+        const float* column = view.numeric[c] + begin;
+        float q = view.query_numeric[c];
+
+        for (std::size_t r = 0; r < n; r++) {
+            sums[r] += numberDistance(column[r], q);
+        }
+    }
+
+    for (std::size_t c = 0; c < view.string_count; c++) {
+        const std::uint32_t* column = view.strings[c] + begin;
+        std::uint32_t q = view.query_strings[c];
+
+        for (std::size_t r = 0; r < n; r++) {
+            sums[r] += column[r] == q ? 0.F : 1.F;
+        }
+    }
+}
+
+#ifdef FINGER_X86_KERNELS
+
+/**
+ * @brief Prefetches the rows of the column read after the current ones, which may be part of the
+ * next block
+ */
+template<typename T>
+void prefetchColumn(const T* column, std::size_t r, std::size_t end) {
+    if (r + PREFETCH_ROWS < end) {
+        __builtin_prefetch(column + r + PREFETCH_ROWS);
+    }
+}
+
+__attribute__((target("avx2"))) void
+avx2Kernel(const ColumnsView& view, std::size_t begin, std::size_t n, float* sums) {
+    static constexpr std::size_t LANES = 8;
+    static constexpr std::size_t LINE_FLOATS = 16;
+
+    std::size_t vectorized = n - n % LANES;
+    const __m256 one = _mm256_set1_ps(1.F);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 sign = _mm256_set1_ps(-0.F);
+
+    for (std::size_t r = 0; r < vectorized; r += LANES) {
+        _mm256_storeu_ps(sums + r, zero);
+    }
+
+    for (std::size_t c = 0; c < view.numeric_count; c++) {
+        const float* column = view.numeric[c] + begin;
+        float qs = view.query_numeric[c];
+        const __m256 q = _mm256_set1_ps(qs);
+        const __m256 qabs = _mm256_andnot_ps(sign, q);
+        const __m256 qfinite =
+        std::isfinite(qs) ? _mm256_castsi256_ps(_mm256_set1_epi32(-1)) : zero;
+
+        for (std::size_t r = 0; r < vectorized; r += LANES) {
+            if (r % LINE_FLOATS == 0) {
+                prefetchColumn(column, r, view.rows - begin);
+            }
+
+            __m256 a = _mm256_loadu_ps(column + r);
+            __m256 abs = _mm256_andnot_ps(sign, a);
+            __m256 diff = _mm256_andnot_ps(sign, _mm256_sub_ps(a, q));
+            __m256 scale = _mm256_max_ps(_mm256_max_ps(abs, qabs), one);
+            __m256 d = _mm256_min_ps(_mm256_div_ps(diff, scale), one);
+
+            // Infinite and NaN values give NaN when subtracted from themselves
+            __m256 finite = _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(a, a), zero, _CMP_EQ_OQ),
+                                          qfinite);
+            __m256 equal = _mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(_mm256_castps_si256(a), _mm256_castps_si256(q)));
+
+            d = _mm256_blendv_ps(one, d, finite);
+            d = _mm256_andnot_ps(equal, d);
+            _mm256_storeu_ps(sums + r, _mm256_add_ps(_mm256_loadu_ps(sums + r), d));
+        }
+    }
+
+    for (std::size_t c = 0; c < view.string_count; c++) {
+        const std::uint32_t* column = view.strings[c] + begin;
+        const __m256i q = _mm256_set1_epi32(static_cast<int>(view.query_strings[c]));
+
+        for (std::size_t r = 0; r < vectorized; r += LANES) {
+            if (r % LINE_FLOATS == 0) {
+                prefetchColumn(column, r, view.rows - begin);
+            }
+
+            __m256i ids = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + r));
+            __m256 equal = _mm256_castsi256_ps(_mm256_cmpeq_epi32(ids, q));
+
+            __m256 d = _mm256_andnot_ps(equal, one);
+
+            _mm256_storeu_ps(sums + r, _mm256_add_ps(_mm256_loadu_ps(sums + r), d));
+        }
+    }
+
+    // The rows left over after the last full vector
+    scalarKernel(view, begin + vectorized, n - vectorized, sums + vectorized);
+}
+
+__attribute__((target("avx512f"))) void
+avx512Kernel(const ColumnsView& view, std::size_t begin, std::size_t n, float* sums) {
+    static constexpr std::size_t LANES = 16;
+
+    std::size_t vectorized = n - n % LANES;
+    // The zero-masked min and max, as the unmasked ones warn about an uninitialized operand on GCC
+    static constexpr __mmask16 ALL = 0xFFFF; // NOLINT(readability-magic-numbers)
+
+    const __m512 one = _mm512_set1_ps(1.F);
+    const __m512 zero = _mm512_setzero_ps();
+
+    for (std::size_t r = 0; r < vectorized; r += LANES) {
+        _mm512_storeu_ps(sums + r, zero);
+    }
+
+    for (std::size_t c = 0; c < view.numeric_count; c++) {
+        const float* column = view.numeric[c] + begin;
+        float qs = view.query_numeric[c];
+        const __m512 q = _mm512_set1_ps(qs);
+        const __m512 qabs = _mm512_abs_ps(q);
+        const __mmask16 qfinite = std::isfinite(qs) ? ALL : 0;
+
+        for (std::size_t r = 0; r < vectorized; r += LANES) {
+            prefetchColumn(column, r, view.rows - begin);
+
+            __m512 a = _mm512_loadu_ps(column + r);
+            __m512 diff = _mm512_abs_ps(_mm512_sub_ps(a, q));
+            __m512 scale = _mm512_maskz_max_ps(ALL, _mm512_abs_ps(a), qabs);
+            scale = _mm512_maskz_max_ps(ALL, scale, one);
+            __m512 d = _mm512_maskz_min_ps(ALL, _mm512_div_ps(diff, scale), one);
+
+            // Infinite and NaN values give NaN when subtracted from themselves
+            __mmask16 finite =
+            _mm512_cmp_ps_mask(_mm512_sub_ps(a, a), zero, _CMP_EQ_OQ) & qfinite;
+            __mmask16 equal =
+            _mm512_cmpeq_epi32_mask(_mm512_castps_si512(a), _mm512_castps_si512(q));
+
+            d = _mm512_mask_blend_ps(finite, one, d);
+            d = _mm512_mask_blend_ps(equal, d, zero);
+            _mm512_storeu_ps(sums + r, _mm512_add_ps(_mm512_loadu_ps(sums + r), d));
+        }
+    }
+
+    for (std::size_t c = 0; c < view.string_count; c++) {
+        const std::uint32_t* column = view.strings[c] + begin;
+        const __m512i q = _mm512_set1_epi32(static_cast<int>(view.query_strings[c]));
+
+        for (std::size_t r = 0; r < vectorized; r += LANES) {
+            prefetchColumn(column, r, view.rows - begin);
+
+            __m512i ids = _mm512_loadu_si512(column + r);
+            __mmask16 equal = _mm512_cmpeq_epi32_mask(ids, q);
+            __m512 sum = _mm512_loadu_ps(sums + r);
+
+            _mm512_storeu_ps(sums + r, _mm512_mask_add_ps(sum, ~equal, sum, one));
+        }
+    }
+
+    // The rows left over after the last full vector
+    scalarKernel(view, begin + vectorized, n - vectorized, sums + vectorized);
+}
+
+#endif
+
+/**
+ * @brief Kernel of the CPU, chosen on first use
+ */
+std::pair<ColumnKernel, const char*> selectKernel() {
+#ifdef FINGER_X86_KERNELS
+    if (__builtin_cpu_supports("avx512f")) {
+        return { avx512Kernel, "avx512" };
+    }
+
+    if (__builtin_cpu_supports("avx2")) {
+        return { avx2Kernel, "avx2" };
+    }
+#endif
+
+    return { scalarKernel, "scalar" };
+}
+
+const std::pair<ColumnKernel, const char*>& kernel() {
+    static const std::pair<ColumnKernel, const char*> selected = selectKernel();
+
+    return selected;
+}
+
+/**
+ * @brief Lower bound of the header order distance from the token masks and list lengths: each
+ * token of a list missing from the other one costs at least an edit, and the normalized distance
+ * grows with the edits
+ */
+double orderBound(std::uint64_t a, std::uint64_t b, std::size_t la, std::size_t lb) {
+    std::size_t missing = std::max(std::popcount(a & ~b), std::popcount(b & ~a));
+    std::size_t edits = std::max(missing, la > lb ? la - lb : lb - la);
+
+    return normalizedEditDistance(edits, la, lb);
+}
+
+/**
+ * @brief Lower bound of the header values distance from the token masks and set sizes: the
+ * Jaccard distance 2d / (|A| + |B| + d) grows with the size d of the symmetric difference
+ */
+double valuesBound(std::uint64_t a, std::uint64_t b, std::size_t la, std::size_t lb) {
+    std::size_t d = std::max<std::size_t>(std::popcount(a ^ b), la > lb ? la - lb : lb - la);
+
+    if (la + lb + d == 0) {
+        return 0;
+    }
+
+    return 2. * static_cast<double>(d) / static_cast<double>(la + lb + d);
+}
+
+/**
+ * @brief Header order distance, as in distance(), the edit distance stopping once the distance is
+ * known to exceed the budget
+ *
+ * @return double The distance, or infinity if greater than the budget
+ */
+double orderDistance(std::span<const std::uint32_t> a,
+                     std::span<const std::uint32_t> b,
+                     double budget) {
+    std::size_t max = SIZE_MAX;
+
+    // 2e / (|a| + |b| + e) <= budget if e <= budget (|a| + |b|) / (2 - budget)
+    if (budget < 1) {
+        auto lengths = static_cast<double>(a.size() + b.size());
+        max = budget < 0 ? 0 : static_cast<std::size_t>(budget * lengths / (2 - budget));
+    }
+
+    std::size_t edits = editDistance(a, b, max);
+
+    if (edits > max) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return normalizedEditDistance(edits, a.size(), b.size());
+}
+
+} // namespace
+
+//--------------------------------------------------------------------------------------//
+//                                        Search                                        //
+//--------------------------------------------------------------------------------------//
+
+template<typename F>
+void FingerprintTable::scan(const Fingerprint& query, double threshold, F&& found) const {
+    checkFeatures(query, _mode, "query");
+
+    std::vector<float> query_numeric;
+    std::vector<const float*> numeric;
+    std::vector<std::uint32_t> query_strings;
+    std::vector<const std::uint32_t*> strings;
+
+    for (std::size_t c = 0; c < _numericFeatures.size(); c++) {
+        query_numeric.push_back(quantize(query.field(_numericFeatures[c])));
+        numeric.push_back(_numeric[c].data());
+    }
+
+    for (std::size_t c = 0; c < _stringFeatures.size(); c++) {
+        auto id = _ids.find(query.field(_stringFeatures[c]).hash);
+
+        query_strings.push_back(id != _ids.end() ? id->second : UNKNOWN_ID);
+        strings.push_back(_strings[c].data());
+    }
+
+    ColumnsView view = { _rows,
+                         numeric.data(),
+                         query_numeric.data(),
+                         numeric.size(),
+                         strings.data(),
+                         query_strings.data(),
+                         strings.size() };
+    ColumnKernel columns = kernel().first;
+
+    std::uint64_t order_mask = tokenMask(query.headerOrder());
+    std::uint64_t values_mask = tokenMask(query.headerValues());
+    auto count = static_cast<double>(_count);
+
+    // Margin over the float sums of the kernel, so that the bounds never drop a matching row
+    double limit = threshold * count + 1e-4; // NOLINT(readability-magic-numbers)
+    std::array<float, BLOCK_ROWS> sums {};
+
+    for (std::size_t begin = 0; begin < _rows; begin += BLOCK_ROWS) {
+        std::size_t n = std::min(BLOCK_ROWS, _rows - begin);
+
+        columns(view, begin, n, sums.data());
+
+        for (std::size_t i = 0; i < n; i++) {
+            std::size_t row = begin + i;
+            double sum = sums[i];
+
+            if (sum > limit) {
+                continue;
+            }
+
+            std::span<const std::uint32_t> order;
+            std::span<const std::uint32_t> values;
+
+            if (_order) {
+                order = { _orderTokens.data() + _orderOffsets[row],
+                          _orderOffsets[row + 1] - _orderOffsets[row] };
+            }
+
+            if (_values) {
+                values = { _valuesTokens.data() + _valuesOffsets[row],
+                           _valuesOffsets[row + 1] - _valuesOffsets[row] };
+            }
+
+            double bound = sum;
+
+            if (_order) {
+                bound += orderBound(_orderMasks[row], order_mask, order.size(),
+                                    query.headerOrder().size());
+            }
+
+            if (_values) {
+                bound += valuesBound(_valuesMasks[row], values_mask, values.size(),
+                                     query.headerValues().size());
+            }
+
+            if (bound > limit) {
+                continue;
+            }
+
+            if (_values) {
+                sum += jaccardDistance(values, query.headerValues());
+            }
+
+            // Edit distance last, it stops early once the row is out of the threshold
+            if (_order) {
+                sum += orderDistance(order, query.headerOrder(), limit - sum);
+            }
+
+            double d = _count == 0 ? 0 : sum / count;
+
+            if (d <= threshold) {
+                found(row, d);
+            }
+        }
+    }
+}
+
+void FingerprintTable::distances(const Fingerprint& query, std::span<double> out) const {
+    if (out.size() != _rows) {
+        throw std::invalid_argument("FingerprintTable: one distance per row expected");
+    }
+
+    scan(query, std::numeric_limits<double>::infinity(), [&](std::size_t row, double d) {
+        out[row] = d;
+    });
+}
+
+std::vector<TableMatch> FingerprintTable::within(const Fingerprint& query, double threshold) const {
+    std::vector<TableMatch> matches;
+
+    scan(query, threshold, [&](std::size_t row, double d) { matches.push_back({ row, d }); });
+
+    return matches;
+}
+
+const char* distance_kernel() { return kernel().second; }
@@ -0,0 +1,347 @@
+/**
+ * @file tables.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the configuration tables loadable at run time
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <finger/configs.hpp>
+#include <finger/tables.hpp>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Compiled tables, used until tables are loaded
+ */
+static constexpr ConfigTables COMPILED_TABLES = {
+    AE, CONN, CONTENC, CACHECONT, TE, ACCEPTCHAR, HEADERS, ACCEPT, CONTENT_TYPE, EXT, HEADER_CODES,
+};
+
+/**
+ * @brief Name of each table in the loaded files
+ */
+static constexpr std::array<std::pair<std::string_view, FrozenMapView ConfigTables::*>, 10>
+TABLE_NAMES = { {
+    { "AE", &ConfigTables::ae },
+    { "CONN", &ConfigTables::conn },
+    { "CONTENC", &ConfigTables::contenc },
+    { "CACHECONT", &ConfigTables::cachecont },
+    { "TE", &ConfigTables::te },
+    { "ACCEPTCHAR", &ConfigTables::acceptchar },
+    { "HEADERS", &ConfigTables::headers },
+    { "ACCEPT", &ConfigTables::accept },
+    { "CONTENT_TYPE", &ConfigTables::content_type },
+    { "EXT", &ConfigTables::ext },
+} };
+
+/**
+ * @brief Largest number of entries of a loaded table, slots hold 16 bits indexes
+ */
+static constexpr std::size_t MAX_TABLE_SIZE = 16383;
+
+//--------------------------------------------------------------------------------------//
+//                                    ConfigSnapshot                                    //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Immutable set of loaded tables, owns the storage the views of its tables point to
+ */
+class ConfigSnapshot {
+  public:
+    explicit ConfigSnapshot(const nlohmann::json& tables) : tables(COMPILED_TABLES) {
+        if (!tables.is_object()) {
+            throw std::invalid_argument("config_load: tables must be a JSON object");
+        }
+
+        for (const auto& [name, table]: tables.items()) {
+            auto known = std::find_if(TABLE_NAMES.begin(), TABLE_NAMES.end(), [&](const auto& t) {
+                return t.first == name;
+            });
+
+            if (known == TABLE_NAMES.end()) {
+                throw std::invalid_argument("config_load: unknown table " + name);
+            }
+
+            this->tables.*(known->second) = build(name, table);
+        }
+
+        if (tables.contains("HEADERS")) {
+            this->tables.header_codes = inverse(this->tables.headers);
+        }
+    }
+
+    ConfigTables tables;
+    std::uint64_t generation = 0;
+
+  private:
+    // Deques, so that the views stay valid while the tables are built
+    std::deque<std::string> _strings;
+    std::deque<std::vector<FrozenEntry>> _entries;
+    std::deque<std::vector<std::uint16_t>> _slots;
+
+    /**
+     * @brief Stores a key or a value
+     */
+    std::string_view store(const nlohmann::json& str, const std::string& name) {
+        if (!str.is_string() || str.get_ref<const std::string&>().empty()) {
+            throw std::invalid_argument("config_load: " + name +
+                                        " keys and values must be non empty strings");
+        }
+
+        return _strings.emplace_back(str.get<std::string>());
+    }
+
+    /**
+     * @brief Builds the frozen table from its JSON description
+     */
+    FrozenMapView build(const std::string& name, const nlohmann::json& table) {
+        std::vector<FrozenEntry>& entries = _entries.emplace_back();
+
+        if (name == "EXT" && table.is_array()) {
+            for (const auto& ext: table) {
+                std::string_view key = store(ext, name);
+                entries.push_back({ key, key });
+            }
+        } else if (name != "EXT" && table.is_object()) {
+            for (const auto& [key, value]: table.items()) {
+                entries.push_back({ store(key, name), store(value, name) });
+            }
+        } else {
+            throw std::invalid_argument("config_load: " + name + " must be " +
+                                        (name == "EXT" ? "an array" : "an object"));
+        }
+
+        if (entries.size() > MAX_TABLE_SIZE) {
+            throw std::invalid_argument("config_load: " + name + " has too many entries");
+        }
+
+        return freeze(entries);
+    }
+
+    /**
+     * @brief Builds the inverse of a loaded table, mapping each value to its key, with the entries
+     * in the same order
+     */
+    FrozenMapView inverse(FrozenMapView table) {
+        std::vector<FrozenEntry>& entries = _entries.emplace_back();
+
+        for (const FrozenEntry& entry: table) {
+            entries.push_back({ entry.value, entry.key });
+        }
+
+        return freeze(entries);
+    }
+
+    /**
+     * @brief Places the entries in the slots of a new frozen table
+     */
+    FrozenMapView freeze(const std::vector<FrozenEntry>& entries) {
+        std::size_t cap = frozen_capacity(entries.size());
+        std::vector<std::uint16_t>& slots = _slots.emplace_back(cap);
+        std::uint32_t seed = frozen_build(entries.data(), entries.size(), slots.data(), cap);
+
+        return { entries.data(), entries.size(), slots.data(), cap - 1, seed };
+    }
+};
+
+//--------------------------------------------------------------------------------------//
+//                                     Publication                                      //
+//--------------------------------------------------------------------------------------//
+
+namespace {
+
+/**
+ * @brief Current loaded tables, nullptr for the compiled tables
+ */
+std::atomic<const ConfigSnapshot*> current { nullptr };
+
+/**
+ * @brief Snapshot used by a reader thread, slots are never freed but reused by new threads
+ */
+struct HazardSlot {
+    std::atomic<const ConfigSnapshot*> snapshot { nullptr };
+    std::atomic<bool> used { false };
+    HazardSlot* next = nullptr;
+};
+
+std::atomic<HazardSlot*> hazard_slots { nullptr };
+
+/**
+ * @brief Serializes the loads, readers never take it
+ */
+std::mutex writer_mutex;
+
+/**
+ * @brief Replaced snapshots still used by a reader, only accessed with the writer mutex held
+ */
+std::vector<const ConfigSnapshot*> retired;
+std::uint64_t last_generation = 0;
+
+/**
+ * @brief Snapshot held by the calling thread
+ */
+struct ThreadReader {
+    HazardSlot* slot = nullptr;
+    const ConfigSnapshot* snapshot = nullptr;
+    std::size_t depth = 0;
+
+    ThreadReader() = default;
+    ThreadReader(const ThreadReader&) = delete;
+    ThreadReader& operator=(const ThreadReader&) = delete;
+
+    ~ThreadReader() {
+        if (slot != nullptr) {
+            slot->snapshot.store(nullptr, std::memory_order_release);
+            slot->used.store(false, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Takes a free slot, or adds one to the list
+     */
+    static HazardSlot* acquireSlot() {
+        for (HazardSlot* s = hazard_slots.load(std::memory_order_acquire); s; s = s->next) {
+            bool expected = false;
+
+            if (!s->used.load(std::memory_order_relaxed) &&
+                s->used.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return s;
+            }
+        }
+
+        auto* s = new HazardSlot(); // NOLINT(cppcoreguidelines-owning-memory)
+        s->used.store(true, std::memory_order_relaxed);
+        s->next = hazard_slots.load(std::memory_order_relaxed);
+
+        while (!hazard_slots.compare_exchange_weak(
+        s->next, s, std::memory_order_release, std::memory_order_relaxed)) { }
+
+        return s;
+    }
+};
+
+thread_local ThreadReader reader;
+
+/**
+ * @brief Frees the retired snapshots no reader holds anymore, the writer mutex must be held
+ *
+ * @return std::size_t Number of retired snapshots still held
+ */
+std::size_t reclaim() {
+    std::vector<const ConfigSnapshot*> held;
+
+    for (HazardSlot* s = hazard_slots.load(std::memory_order_acquire); s; s = s->next) {
+        held.push_back(s->snapshot.load(std::memory_order_seq_cst));
+    }
+
+    auto freed = std::partition(retired.begin(), retired.end(), [&](const ConfigSnapshot* r) {
+        return std::find(held.begin(), held.end(), r) != held.end();
+    });
+
+    std::for_each(freed, retired.end(), [](const ConfigSnapshot* r) { delete r; });
+    retired.erase(freed, retired.end());
+
+    return retired.size();
+}
+
+/**
+ * @brief Publishes the snapshot (nullptr for the compiled tables) and retires the previous one
+ */
+void publish(std::unique_ptr<ConfigSnapshot> snapshot) {
+    std::lock_guard<std::mutex> lock(writer_mutex);
+
+    if (snapshot) {
+        snapshot->generation = ++last_generation;
+    }
+
+    const ConfigSnapshot* previous = current.exchange(snapshot.release());
+
+    if (previous != nullptr) {
+        retired.push_back(previous);
+    }
+
+    reclaim();
+}
+
+} // namespace
+
+//--------------------------------------------------------------------------------------//
+//                                     ConfigGuard                                      //
+//--------------------------------------------------------------------------------------//
+
+ConfigGuard::ConfigGuard() {
+    if (reader.depth++ == 0) {
+        if (reader.slot == nullptr) {
+            reader.slot = ThreadReader::acquireSlot();
+        }
+
+        // Publishes the snapshot before using it, and checks it was not replaced meanwhile: a
+        // writer that replaces it afterwards sees the hazard and does not free it
+        const ConfigSnapshot* snapshot = current.load(std::memory_order_acquire);
+
+        for (;;) {
+            reader.slot->snapshot.store(snapshot, std::memory_order_seq_cst);
+
+            const ConfigSnapshot* check = current.load(std::memory_order_seq_cst);
+
+            if (check == snapshot) {
+                break;
+            }
+
+            snapshot = check;
+        }
+
+        reader.snapshot = snapshot;
+    }
+
+    _tables = reader.snapshot ? &reader.snapshot->tables : &COMPILED_TABLES;
+    _generation = reader.snapshot ? reader.snapshot->generation : 0;
+}
+
+ConfigGuard::~ConfigGuard() {
+    if (--reader.depth == 0) {
+        reader.slot->snapshot.store(nullptr, std::memory_order_release);
+        reader.snapshot = nullptr;
+    }
+}
+
+//--------------------------------------------------------------------------------------//
+//                                       Loading                                        //
+//--------------------------------------------------------------------------------------//
+
+void config_load(const nlohmann::json& tables) {
+    publish(std::make_unique<ConfigSnapshot>(tables));
+}
+
+void config_load_file(const std::string& path) {
+    std::ifstream file(path);
+
+    if (!file) {
+        throw std::invalid_argument("config_load_file: cannot read " + path);
+    }
+
+    nlohmann::json tables = nlohmann::json::parse(file, nullptr, false);
+
+    if (tables.is_discarded()) {
+        throw std::invalid_argument("config_load_file: invalid JSON in " + path);
+    }
+
+    config_load(tables);
+}
+
+void config_reset() { publish(nullptr); }
+
+std::size_t config_reclaim() {
+    std::lock_guard<std::mutex> lock(writer_mutex);
+
+    return reclaim();
+}
@@ -0,0 +1,371 @@
+/**
+ * @file vptree.cpp
+ * @author Gautier Miquet
+ * @brief Implementation of the vantage-point tree, a metric index of reference fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <cstring>
+#include <finger/vptree.hpp>
+#include <future>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Largest range stored as a leaf, its fingerprints are all compared to the query
+ */
+static constexpr std::size_t LEAF_SIZE = 8;
+
+/**
+ * @brief Smallest range whose distances to the vantage point are computed by several threads
+ */
+static constexpr std::size_t PARALLEL_SIZE = 4096;
+
+/**
+ * @brief Slack of the pruning tests, for the rounding errors of the distances
+ */
+static constexpr double EPSILON = 1e-9;
+
+/**
+ * @brief Header of the saved trees
+ */
+static constexpr char MAGIC[4] = { 'F', 'P', 'V', 'T' }; // NOLINT(modernize-avoid-c-arrays)
+static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+//--------------------------------------------------------------------------------------//
+//                                     Construction                                     //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Splits [0, n) in chunks handled by f(chunk, begin, end), the first one on the calling
+ * thread and the others on their own threads
+ */
+template<typename F>
+static void parallelChunks(std::size_t n, std::size_t chunks, F&& f) {
+    std::vector<std::future<void>> pending;
+    std::size_t size = (n + chunks - 1) / chunks;
+
+    for (std::size_t c = 1; c < chunks && c * size < n; c++) {
+        pending.push_back(std::async(std::launch::async, [&f, c, size, n]() {
+            f(c, c * size, std::min((c + 1) * size, n));
+        }));
+    }
+
+    f(0, 0, std::min(size, n));
+
+    // Rethrows the exceptions of the other threads
+    for (auto& p: pending) {
+        p.get();
+    }
+}
+
+/**
+ * @brief Number of threads to use, one per core if 0
+ */
+static std::size_t threadCount(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    return std::max<std::size_t>(threads, 1);
+}
+
+/**
+ * @brief Pseudo-random position of the vantage point of a node, the same for a given node so that
+ * the tree does not depend on the number of threads
+ */
+static std::size_t vantagePoint(std::size_t lo, std::size_t n) {
+    std::uint64_t x = (lo + 1) * 0x9E3779B97F4A7C15ULL; // NOLINT(readability-magic-numbers)
+    x ^= x >> 31U;                                      // NOLINT(readability-magic-numbers)
+
+    return lo + x % n;
+}
+
+VPTree::VPTree(const FeatureTypes& mode, std::vector<std::string> texts, std::size_t threads)
+: _mode(mode), _texts(std::move(texts)) {
+    if (_texts.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("VPTree: too many fingerprints");
+    }
+
+    std::size_t chunks = std::min(threadCount(threads), std::max<std::size_t>(_texts.size(), 1));
+    std::vector<std::vector<Fingerprint>> parsed(chunks);
+
+    parallelChunks(_texts.size(), chunks, [&](std::size_t c, std::size_t begin, std::size_t end) {
+        parsed[c].reserve(end - begin);
+
+        for (std::size_t i = begin; i < end; i++) {
+            parsed[c].emplace_back(_texts[i], _mode);
+        }
+    });
+
+    _fingerprints.reserve(_texts.size());
+
+    for (auto& part: parsed) {
+        std::move(part.begin(), part.end(), std::back_inserter(_fingerprints));
+    }
+}
+
+VPTree::VPTree(std::vector<std::string> fingerprints, const FeatureTypes& mode,
+               std::size_t threads)
+: VPTree(mode, std::move(fingerprints), threads) {
+    _nodes.resize(_texts.size());
+    _radius.resize(_texts.size());
+
+    for (std::size_t i = 0; i < _nodes.size(); i++) {
+        _nodes[i] = static_cast<std::uint32_t>(i);
+    }
+
+    build(0, _nodes.size(), threadCount(threads));
+}
+
+void VPTree::build(std::size_t lo, std::size_t hi, std::size_t threads) {
+    std::size_t n = hi - lo;
+
+    if (n <= LEAF_SIZE) {
+        return;
+    }
+
+    std::swap(_nodes[lo], _nodes[vantagePoint(lo, n)]);
+
+    // Splits the other fingerprints at the median of their distance to the vantage point, ties
+    // broken by position to keep the tree deterministic
+    std::size_t median = (n - 1) / 2;
+    {
+        const Fingerprint& point = _fingerprints[_nodes[lo]];
+        std::vector<std::pair<double, std::uint32_t>> others(n - 1);
+        std::size_t chunks = n >= PARALLEL_SIZE ? threads : 1;
+
+        parallelChunks(n - 1, chunks, [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::uint32_t node = _nodes[lo + 1 + i];
+                others[i] = { distance(point, _fingerprints[node], _mode), node };
+            }
+        });
+
+        std::nth_element(others.begin(), others.begin() + median, others.end());
+        _radius[lo] = others[median].first;
+
+        for (std::size_t i = 0; i < others.size(); i++) {
+            _nodes[lo + 1 + i] = others[i].second;
+        }
+    }
+
+    // The inside half, closer than the median, then the outside half
+    std::size_t split = lo + 1 + median;
+
+    if (threads > 1) {
+        auto inside =
+        std::async(std::launch::async, [this, lo, split, threads]() {
+            build(lo + 1, split, threads / 2);
+        });
+
+        build(split, hi, threads - threads / 2);
+        inside.get();
+    } else {
+        build(lo + 1, split, 1);
+        build(split, hi, 1);
+    }
+}
+
+//--------------------------------------------------------------------------------------//
+//                                        Search                                        //
+//--------------------------------------------------------------------------------------//
+
+template<typename F>
+void VPTree::search(const Fingerprint& query, std::size_t lo, std::size_t hi, double& tau,
+                    F& found) const {
+    std::size_t n = hi - lo;
+
+    if (n <= LEAF_SIZE) {
+        for (std::size_t i = lo; i < hi; i++) {
+            found(_nodes[i], distance(query, _fingerprints[_nodes[i]], _mode));
+        }
+
+        return;
+    }
+
+    double d = distance(query, _fingerprints[_nodes[lo]], _mode);
+    double mu = _radius[lo];
+    std::size_t split = lo + 1 + (n - 1) / 2;
+
+    found(_nodes[lo], d);
+
+    // Triangle inequality: the inside fingerprints are at least at d - mu from the query, the
+    // outside ones at mu - d. The half holding the query is searched first, to lower tau sooner.
+    if (d < mu) {
+        search(query, lo + 1, split, tau, found);
+
+        if (mu - d <= tau + EPSILON) {
+            search(query, split, hi, tau, found);
+        }
+    } else {
+        search(query, split, hi, tau, found);
+
+        if (d - mu <= tau + EPSILON) {
+            search(query, lo + 1, split, tau, found);
+        }
+    }
+}
+
+/**
+ * @brief Orders the matches by distance, then by position
+ */
+static bool closer(const TableMatch& a, const TableMatch& b) {
+    return a.distance < b.distance || (a.distance == b.distance && a.row < b.row);
+}
+
+std::vector<TableMatch> VPTree::knn(const Fingerprint& query, std::size_t k) const {
+    std::priority_queue<TableMatch, std::vector<TableMatch>, decltype(&closer)> best(closer);
+    double tau = std::numeric_limits<double>::infinity();
+
+    if (k == 0) {
+        return {};
+    }
+
+    auto found = [&](std::size_t row, double d) {
+        if (best.size() < k) {
+            best.push({ row, d });
+        } else if (closer({ row, d }, best.top())) {
+            best.pop();
+            best.push({ row, d });
+        }
+
+        if (best.size() == k) {
+            tau = best.top().distance;
+        }
+    };
+
+    search(query, 0, _nodes.size(), tau, found);
+
+    std::vector<TableMatch> matches(best.size());
+
+    for (std::size_t i = matches.size(); i > 0; i--) {
+        matches[i - 1] = best.top();
+        best.pop();
+    }
+
+    return matches;
+}
+
+std::vector<TableMatch> VPTree::within(const Fingerprint& query, double radius) const {
+    std::vector<TableMatch> matches;
+
+    auto found = [&](std::size_t row, double d) {
+        if (d <= radius) {
+            matches.push_back({ row, d });
+        }
+    };
+
+    search(query, 0, _nodes.size(), radius, found);
+    std::sort(matches.begin(), matches.end(), closer);
+
+    return matches;
+}
+
+//--------------------------------------------------------------------------------------//
+//                                    Serialization                                     //
+//--------------------------------------------------------------------------------------//
+
+/**
+ * @brief Writes a value in the native byte order
+ */
+template<typename T>
+static void writeValue(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Reads a value written by writeValue()
+ */
+template<typename T>
+static T readValue(std::istream& in) {
+    T value {};
+
+    if (!in.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+        throw std::invalid_argument("VPTree::load: truncated stream");
+    }
+
+    return value;
+}
+
+void VPTree::save(std::ostream& out) const {
+    out.write(MAGIC, sizeof(MAGIC));
+    writeValue(out, FORMAT_VERSION);
+    out.write(_mode.data(), static_cast<std::streamsize>(_mode.size()));
+    writeValue(out, static_cast<std::uint64_t>(_texts.size()));
+
+    for (const std::string& text: _texts) {
+        writeValue(out, static_cast<std::uint32_t>(text.size()));
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    out.write(reinterpret_cast<const char*>(_nodes.data()),
+              static_cast<std::streamsize>(_nodes.size() * sizeof(std::uint32_t)));
+    out.write(reinterpret_cast<const char*>(_radius.data()),
+              static_cast<std::streamsize>(_radius.size() * sizeof(double)));
+}
+
+VPTree VPTree::load(std::istream& in) {
+    char magic[sizeof(MAGIC)]; // NOLINT(modernize-avoid-c-arrays)
+
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::invalid_argument("VPTree::load: not a saved tree");
+    }
+
+    if (readValue<std::uint32_t>(in) != FORMAT_VERSION) {
+        throw std::invalid_argument("VPTree::load: unsupported version");
+    }
+
+    FeatureTypes mode {};
+
+    for (char& type: mode) {
+        type = readValue<char>(in);
+    }
+
+    auto count = readValue<std::uint64_t>(in);
+
+    if (count > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("VPTree::load: too many fingerprints");
+    }
+
+    std::vector<std::string> texts;
+
+    for (std::uint64_t i = 0; i < count; i++) {
+        std::string text(readValue<std::uint32_t>(in), '\0');
+
+        if (!in.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+            throw std::invalid_argument("VPTree::load: truncated stream");
+        }
+
+        texts.push_back(std::move(text));
+    }
+
+    VPTree tree(mode, std::move(texts), 0);
+    tree._nodes.resize(count);
+    tree._radius.resize(count);
+
+    if (!in.read(reinterpret_cast<char*>(tree._nodes.data()),
+                 static_cast<std::streamsize>(count * sizeof(std::uint32_t))) ||
+        !in.read(reinterpret_cast<char*>(tree._radius.data()),
+                 static_cast<std::streamsize>(count * sizeof(double)))) {
+        throw std::invalid_argument("VPTree::load: truncated stream");
+    }
+
+    // Each fingerprint must be in a single node
+    std::vector<bool> seen(count);
+
+    for (std::uint32_t node: tree._nodes) {
+        if (node >= count || seen[node]) {
+            throw std::invalid_argument("VPTree::load: invalid nodes");
+        }
+
+        seen[node] = true;
+    }
+
+    return tree;
+}
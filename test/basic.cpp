@@ -1,98 +1,225 @@
-/**
- * @file basic.cpp
- * @author Gautier Miquet
- * @brief Very first and basic test
- * @version 1.0.0
- * @date 2022-03-03
- */
-#include <finger/fingerprint.hpp>
-#include <test/dataset.hpp>
-
-// clang-format off
-#include <CppUTest/CommandLineTestRunner.h>
-#include <CppUTest/TestHarness.h>
-// clang-format on
-
-TEST_GROUP(Basic) {};
-
-TEST(Basic, FingerprintURINoext) {
-    auto set = dataset_use("test/data/dataset_basic.json", { "sets", "uri-noext" });
-
-    for (auto& entry: set) {
-        if (!dataset_contains(entry, { "uri", "fingerprint" })) {
-            continue;
-        }
-
-        std::string expected = entry["fingerprint"].get<std::string>();
-        std::string uri = entry["uri"].get<std::string>();
-
-        auto fp = uri_fingerprint(uri);
-
-        STRCMP_EQUAL(expected.c_str(), fp.c_str());
-    }
-}
-
-TEST(Basic, FingerprintURIExt) {
-    auto set = dataset_use("test/data/dataset_basic.json", { "sets", "uri-ext" });
-
-    for (auto& entry: set) {
-        if (!dataset_contains(entry, { "uri", "fingerprint" })) {
-            continue;
-        }
-
-        std::string expected = entry["fingerprint"].get<std::string>();
-        std::string uri = entry["uri"].get<std::string>();
-
-        auto fp = uri_fingerprint(uri);
-
-        STRCMP_EQUAL(expected.c_str(), fp.c_str());
-    }
-}
-
-TEST(Basic, FingerprintFullNopayload) {
-    auto set = dataset_use("test/data/dataset_basic.json", { "sets", "full-nopayload" });
-
-    for (auto& entry: set) {
-        if (!dataset_contains(entry, { "uri", "method", "version", "headers", "fingerprint" })) {
-            continue;
-        }
-
-        std::string expected = entry["fingerprint"].get<std::string>();
-        std::string uri = entry["uri"].get<std::string>();
-        std::string method = entry["method"].get<std::string>();
-        std::string version = entry["version"].get<std::string>();
-        std::vector<std::string> headers = entry["headers"].get<std::vector<std::string>>();
-
-        HTTPRequest req(uri, method, version, headers);
-
-        auto fp = fingerprint(req);
-
-        STRCMP_EQUAL(expected.c_str(), fp.c_str());
-    }
-}
-
-TEST(Basic, FingerprintFullPayload) {
-    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
-
-    for (auto& entry: set) {
-        if (!dataset_contains(
-            entry, { "uri", "method", "version", "headers", "payload", "fingerprint" })) {
-            continue;
-        }
-
-        std::string expected = entry["fingerprint"].get<std::string>();
-        std::string uri = entry["uri"].get<std::string>();
-        std::string method = entry["method"].get<std::string>();
-        std::string version = entry["version"].get<std::string>();
-        std::vector<std::string> headers = entry["headers"].get<std::vector<std::string>>();
-        std::string payload = entry["payload"].get<std::string>();
-
-        HTTPRequest req(uri, method, version, headers, payload);
-
-        auto fp = fingerprint(req);
-
-        STRCMP_EQUAL(expected.c_str(), fp.c_str());
-    }
-}
-
+/**
+ * @file basic.cpp
+ * @author Gautier Miquet
+ * @brief Very first and basic test
+ * @version 1.0.0
+ * @date 2022-03-03
+ */
+#include <array>
+#include <finger/fingerprint.hpp>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+TEST_GROUP(Basic) {};
+
+TEST(Basic, FingerprintURINoext) {
+    auto set = dataset_use("test/data/dataset_basic.json", { "sets", "uri-noext" });
+
+    for (auto& entry: set) {
+        if (!dataset_contains(entry, { "uri", "fingerprint" })) {
+            continue;
+        }
+
+        std::string expected = entry["fingerprint"].get<std::string>();
+        std::string uri = entry["uri"].get<std::string>();
+
+        auto fp = uri_fingerprint(uri);
+
+        STRCMP_EQUAL(expected.c_str(), fp.c_str());
+    }
+}
+
+TEST(Basic, FingerprintURIExt) {
+    auto set = dataset_use("test/data/dataset_basic.json", { "sets", "uri-ext" });
+
+    for (auto& entry: set) {
+        if (!dataset_contains(entry, { "uri", "fingerprint" })) {
+            continue;
+        }
+
+        std::string expected = entry["fingerprint"].get<std::string>();
+        std::string uri = entry["uri"].get<std::string>();
+
+        auto fp = uri_fingerprint(uri);
+
+        STRCMP_EQUAL(expected.c_str(), fp.c_str());
+    }
+}
+
+TEST(Basic, FingerprintFullNopayload) {
+    auto set = dataset_use("test/data/dataset_basic.json", { "sets", "full-nopayload" });
+
+    for (auto& entry: set) {
+        if (!dataset_contains(entry, { "uri", "method", "version", "headers", "fingerprint" })) {
+            continue;
+        }
+
+        std::string expected = entry["fingerprint"].get<std::string>();
+        std::string uri = entry["uri"].get<std::string>();
+        std::string method = entry["method"].get<std::string>();
+        std::string version = entry["version"].get<std::string>();
+        std::vector<std::string> headers = entry["headers"].get<std::vector<std::string>>();
+
+        HTTPRequest req(uri, method, version, headers);
+
+        auto fp = fingerprint(req);
+
+        STRCMP_EQUAL(expected.c_str(), fp.c_str());
+    }
+}
+
+TEST(Basic, FingerprintFullPayload) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+
+    for (auto& entry: set) {
+        if (!dataset_contains(
+            entry, { "uri", "method", "version", "headers", "payload", "fingerprint" })) {
+            continue;
+        }
+
+        std::string expected = entry["fingerprint"].get<std::string>();
+        std::string uri = entry["uri"].get<std::string>();
+        std::string method = entry["method"].get<std::string>();
+        std::string version = entry["version"].get<std::string>();
+        std::vector<std::string> headers = entry["headers"].get<std::vector<std::string>>();
+        std::string payload = entry["payload"].get<std::string>();
+
+        HTTPRequest req(uri, method, version, headers, payload);
+
+        auto fp = fingerprint(req);
+
+        STRCMP_EQUAL(expected.c_str(), fp.c_str());
+    }
+}
+
+TEST(Basic, FingerprintHeaderPairs) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+
+    for (auto& entry: set) {
+        if (!dataset_contains(entry, { "headers" })) {
+            continue;
+        }
+
+        std::vector<std::string> headers = entry["headers"].get<std::vector<std::string>>();
+        std::vector<HeaderField> fields;
+
+        for (const std::string& header: headers) {
+            std::size_t colon = header.find(": ");
+
+            fields.emplace_back(std::string_view(header).substr(0, colon),
+                                std::string_view(header).substr(colon + 2));
+        }
+
+        STRCMP_EQUAL(header_fingerprint(headers).c_str(), header_fingerprint(fields).c_str());
+    }
+}
+
+TEST(Basic, HeaderValueTokens) {
+    FrozenMapView ae = AE;
+
+    // Single and compound values
+    STRCMP_EQUAL("ac-en:gz", encodeHeaderValue("gzip", "accept-encoding", ae).c_str());
+    STRCMP_EQUAL("ac-en:gz,de,br",
+                 encodeHeaderValue("gzip, deflate,br", "accept-encoding", ae).c_str());
+    STRCMP_EQUAL(("ac-en:" + hexHash("gzip deflate")).c_str(),
+                 encodeHeaderValue("gzip deflate", "accept-encoding", ae).c_str());
+
+    // The first unknown or empty token is hashed alone
+    STRCMP_EQUAL(("ac-en:" + hexHash("foo")).c_str(),
+                 encodeHeaderValue("gzip, foo, bar", "accept-encoding", ae).c_str());
+    STRCMP_EQUAL(("ac-en:" + hexHash("")).c_str(),
+                 encodeHeaderValue(", gzip", "accept-encoding", ae).c_str());
+
+    // Unless a later token has a quality parameter, then the whole value is
+    STRCMP_EQUAL(("ac-en:" + hexHash("foo, gzip;q=0.5")).c_str(),
+                 encodeHeaderValue("foo, gzip;q=0.5", "accept-encoding", ae).c_str());
+    STRCMP_EQUAL(("ac-en:" + hexHash("br, gzip ; q=0.5")).c_str(),
+                 encodeHeaderValue("br, gzip ; q=0.5", "accept-encoding", ae).c_str());
+    STRCMP_EQUAL(("ac-en:" + hexHash("gzip;  q=0.5")).c_str(),
+                 encodeHeaderValue("br, gzip;  q=0.5", "accept-encoding", ae).c_str());
+
+    // Whitespace around ';': at most one space after it
+    CHECK(hasQualityParameter("gzip;q=0.5"));
+    CHECK(hasQualityParameter("gzip; q=0.5"));
+    CHECK(hasQualityParameter("gzip ; q=0.5"));
+    CHECK(hasQualityParameter("gzip;level=1;q=0.5"));
+    CHECK(!hasQualityParameter("gzip;  q=0.5"));
+    CHECK(!hasQualityParameter("gzip;level=1"));
+    CHECK(!hasQualityParameter("q=0.5"));
+    CHECK(!hasQualityParameter("gzip;"));
+}
+
+TEST(Basic, HeaderCase) {
+    // Single segment: its first letter
+    CHECK(getHeaderCase("Host"));
+    CHECK(!getHeaderCase("host"));
+    CHECK(!getHeaderCase("1host"));
+    CHECK(!getHeaderCase(""));
+
+    // Longer than a word, with a tail
+    CHECK(getHeaderCase("Content-Type"));
+    CHECK(!getHeaderCase("Content-type"));
+    CHECK(getHeaderCase("X-Forwarded-For"));
+    CHECK(!getHeaderCase("X-Forwarded-for"));
+    CHECK(getHeaderCase("Accept-Language-Extra-Long-Name-X"));
+    CHECK(!getHeaderCase("Accept-Language-Extra-Long-Name-x"));
+    CHECK(getHeaderCase("Userdefinedheader"));
+
+    // Dashes on both sides of the word boundary
+    CHECK(getHeaderCase("Abcdefg-Hij"));
+    CHECK(!getHeaderCase("Abcdefg-hij"));
+    CHECK(getHeaderCase("Abcdefgh-Ij"));
+    CHECK(!getHeaderCase("Abcdefgh-ij"));
+    CHECK(getHeaderCase("Abcdefg-"));
+
+    // Bytes >= 0x80 are not letters, even with the bits of one
+    CHECK(!getHeaderCase("\xE1" "bc"));
+    CHECK(getHeaderCase("\xC3\xA9-Abc"));
+    CHECK(getHeaderCase("X-\xE1\xE2\xE3\xE4\xE5\xE6-\xFA"));
+    CHECK(!getHeaderCase("X-\xE1\xE2\xE3\xE4\xE5\xE6-z"));
+
+    // The batch version, in the header order
+    std::vector<std::string> lines = { "Host: a",        "user-agent: b",      "Abcdefgh-ij: c",
+                                       ": d",            "X-Forwarded-For: e", "\xE1: f",
+                                       "Accept-Encoding: g" };
+    std::vector<HeaderView> views;
+
+    for (const std::string& line: lines) {
+        views.push_back(splitHeaderLine(line));
+    }
+
+    // One more output than headers, left untouched
+    std::array<bool, 8> cases {};
+    cases.back() = true;
+    getHeaderCases(views, cases);
+
+    for (std::size_t i = 0; i < views.size(); i++) {
+        CHECK_EQUAL(getHeaderCase(views[i].name), cases[i]);
+    }
+
+    CHECK(cases.back());
+    CHECK_THROWS(std::invalid_argument,
+                 getHeaderCases(views, std::span<bool>(cases).first(views.size() - 1)));
+}
+
+TEST(Basic, Entropy) {
+    std::string bytes;
+
+    for (int c = 0; c < 256; c++) {
+        bytes += static_cast<char>(c);
+    }
+
+    DOUBLES_EQUAL(1.0, entropy("abab"), 0);
+    DOUBLES_EQUAL(2.0, entropy("abcd"), 0);
+    DOUBLES_EQUAL(8.0, entropy(bytes), 0);
+    DOUBLES_EQUAL(1.5, entropy("aabc"), 0);
+
+    // A single byte value gives a negative zero, printed "-0" in the payload fingerprint
+    CHECK(std::signbit(entropy("aaaa")));
+}
+
 int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
\ No newline at end of file
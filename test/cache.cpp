@@ -0,0 +1,104 @@
+/**
+ * @file cache.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the memoization caches
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <finger/cache.hpp>
+#include <finger/fingerprint.hpp>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+TEST_GROUP(Cache) {};
+
+TEST(Cache, ValueCacheEviction) {
+    ValueCache cache(2);
+
+    CHECK(cache.find("a", 0) == nullptr);
+    cache.insert("a", 0, "A");
+    STRCMP_EQUAL("A", cache.find("a", 0)->c_str());
+
+    // Same slot, different key: never returned as a hit
+    CHECK(cache.find("c", 2) == nullptr);
+    cache.insert("c", 2, "C");
+    CHECK(cache.find("a", 0) == nullptr);
+
+    UNSIGNED_LONGS_EQUAL(1, cache.stats().hits);
+    UNSIGNED_LONGS_EQUAL(3, cache.stats().misses);
+
+    // Capacities are rounded up to a power of 2, up to the largest one
+    ValueCache three(3);
+    three.insert("a", 0, "A");
+    three.insert("c", 2, "C");
+    STRCMP_EQUAL("A", three.find("a", 0)->c_str());
+    STRCMP_EQUAL("C", three.find("c", 2)->c_str());
+
+    ValueCache largest(ValueCache::MAX_CAPACITY);
+    CHECK(largest.find("a", 0) == nullptr);
+
+    CHECK_THROWS(std::invalid_argument, ValueCache(ValueCache::MAX_CAPACITY + 1));
+    CHECK_THROWS(std::invalid_argument, ValueCache(~std::size_t(0)));
+    CHECK_THROWS(std::invalid_argument, value_cache_enable(ValueCache::MAX_CAPACITY + 1));
+    CHECK_THROWS(std::invalid_argument, header_cache_enable(~std::size_t(0)));
+}
+
+TEST(Cache, MemoizedHeaderValues) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+
+    value_cache_enable(16);
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (auto& entry: set) {
+            if (!dataset_contains(
+                entry, { "uri", "method", "version", "headers", "payload", "fingerprint" })) {
+                continue;
+            }
+
+            std::string expected = entry["fingerprint"].get<std::string>();
+            HTTPRequest req(entry["uri"].get<std::string>(),
+                            entry["method"].get<std::string>(),
+                            entry["version"].get<std::string>(),
+                            entry["headers"].get<std::vector<std::string>>(),
+                            entry["payload"].get<std::string>());
+
+            STRCMP_EQUAL(expected.c_str(), fingerprint(req).c_str());
+        }
+    }
+
+    CHECK(value_cache_stats(CachedHeader::UserAgent).hits > 0);
+    CHECK(value_cache_stats(CachedHeader::UserAgent).misses > 0);
+
+    value_cache_disable();
+    CHECK(value_cache(CachedHeader::UserAgent) == nullptr);
+}
+
+TEST(Cache, MemoizedHeaderBlocks) {
+    std::vector<std::string> first = { "Host: localhost",
+                                       "User-Agent: curl/7.68.0",
+                                       "Accept: */*",
+                                       "Cookie: PHPSESSID=84r3pfdb2j624giv" };
+    std::vector<std::string> second = first;
+    second[3] = "Cookie: PHPSESSID=g1vl3t4lkc0tbm2a";
+
+    std::string expected = header_fingerprint(first);
+
+    header_cache_enable(16);
+
+    STRCMP_EQUAL(expected.c_str(), header_fingerprint(first).c_str());
+    STRCMP_EQUAL(expected.c_str(), header_fingerprint(second).c_str());
+    UNSIGNED_LONGS_EQUAL(1, header_cache_stats().hits);
+
+    // Encoded values are part of the key
+    second[1] = "User-Agent: curl/7.81.0";
+    CHECK(expected != header_fingerprint(second));
+    UNSIGNED_LONGS_EQUAL(2, header_cache_stats().misses);
+
+    header_cache_disable();
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
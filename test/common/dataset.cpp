@@ -6,7 +6,10 @@
  * @date 2022-04-23
  *
  */
+#include <algorithm>
+#include <finger/configs.hpp>
 #include <fstream>
+#include <random>
 #include <stdexcept>
 #include <test/dataset.hpp>
 
@@ -41,3 +44,96 @@ bool dataset_contains(nlohmann::json j, const std::vector<std::string> fields) {
 
     return true;
 }
+
+std::vector<std::string> dataset_fingerprints() {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::string> fingerprints;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "fingerprint" })) {
+            fingerprints.push_back(entry["fingerprint"].get<std::string>());
+        }
+    }
+
+    return fingerprints;
+}
+
+std::vector<std::string> dataset_perturb(const std::vector<std::string>& base,
+                                         std::size_t count,
+                                         unsigned seed,
+                                         bool shuffled) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::vector<std::string> fingerprints;
+    fingerprints.reserve(count);
+
+    for (std::size_t i = 0; i < count; i++) {
+        std::vector<std::string> fields(1);
+
+        for (char c: base[shuffled ? rng() % base.size() : i % base.size()]) {
+            if (c == '|') {
+                fields.emplace_back();
+            } else {
+                fields.back() += c;
+            }
+        }
+
+        // URI length and directory size
+        fields[FEATURE_URI_LENGTH] = std::to_string(digit(rng)) + "." + std::to_string(digit(rng));
+        fields[FEATURE_DIRECTORY_SIZE] = "0." + std::to_string(digit(rng));
+
+        // Header order: swaps the first two headers of 30% of the fingerprints
+        std::string& order = fields[FEATURE_HEADER_ORDER];
+        std::size_t comma = order.find(',');
+
+        if (digit(rng) < 3 && comma != std::string::npos) {
+            std::size_t next = std::min(order.find(',', comma + 1), order.size());
+            order = order.substr(comma + 1, next - comma - 1) + "," + order.substr(0, comma) +
+                    order.substr(next);
+        }
+
+        std::string fp = fields[0];
+
+        for (std::size_t f = 1; f < fields.size(); f++) {
+            fp += "|" + fields[f];
+        }
+
+        fingerprints.push_back(std::move(fp));
+    }
+
+    return fingerprints;
+}
+
+std::vector<std::string> dataset_references(std::size_t count,
+                                            unsigned seed,
+                                            bool shuffled,
+                                            unsigned uri_digits) {
+    std::vector<std::string> base = dataset_fingerprints();
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::vector<std::string> fingerprints;
+
+    for (std::size_t i = 0; i < count; i++) {
+        std::string fp = base[shuffled ? rng() % base.size() : i % base.size()];
+
+        // URI length, its digits drawn from the last one
+        std::string uri_length = "." + std::to_string(digit(rng));
+
+        for (unsigned d = 0; d < uri_digits; d++) {
+            uri_length.insert(0, std::to_string(digit(rng)));
+        }
+
+        fp = uri_length + fp.substr(fp.find('|'));
+
+        // Drops the second header of the header order of some fingerprints
+        std::size_t comma = fp.find(',');
+
+        if (digit(rng) < 3 && comma != std::string::npos) {
+            fp.erase(comma, fp.find_first_of(",|", comma + 1) - comma);
+        }
+
+        fingerprints.push_back(fp);
+    }
+
+    return fingerprints;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file distance.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the distance between fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <finger/distance.hpp>
+#include <finger/modes.hpp>
+#include <random>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+static constexpr double TOLERANCE = 1e-9;
+
+TEST_GROUP(Distance) {};
+
+TEST(Distance, Comparators) {
+    constexpr FeatureTypes URI = { 'f', 's', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    // Same fingerprint
+    DOUBLES_EQUAL(0, distance("1.5|2", "1.5|2", URI), TOLERANCE);
+
+    // 'f': |2 - 1.5| / 2, 's': exact match
+    DOUBLES_EQUAL(0.125, distance("1.5|2", "2.0|2", URI), TOLERANCE);
+    DOUBLES_EQUAL(0.625, distance("1.5|2", "2.0|3", URI), TOLERANCE);
+
+    // Values below 1 are compared on an absolute scale, empty features only match empty ones
+    DOUBLES_EQUAL(0.1, distance("0.4|", "0.2|", URI), TOLERANCE);
+    DOUBLES_EQUAL(0.5, distance("0.4|2", "0.4|", URI), TOLERANCE);
+
+    // Header order: one substitution between 4 headers lists, 2 / (4 + 4 + 1), header values: 2
+    // common out of 4 values
+    constexpr FeatureTypes HEADERS = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 's', 's', 0, 0, 0 };
+    DOUBLES_EQUAL(2. / 9 / 2,
+                  distance("ho,ac,co,us-ag|", "ho,ac,ca-co,us-ag|", HEADERS),
+                  TOLERANCE);
+    DOUBLES_EQUAL(0.5 / 2,
+                  distance("|ac:te/ht,ap/js/co:ke-al/ac-en:gz",
+                           "|co:ke-al/ac:te/ht,ap/js/ac-la:en",
+                           HEADERS),
+                  TOLERANCE);
+
+    CHECK_THROWS(std::invalid_argument, distance("1.5|2|3", "1.5|2", URI));
+    CHECK_THROWS(std::invalid_argument, distance("1.5", "1.5|2", URI));
+}
+
+/**
+ * @brief Edit distance computed with the whole dynamic programming matrix
+ */
+static std::size_t reference_edit_distance(const std::vector<std::uint32_t>& a,
+                                           const std::vector<std::uint32_t>& b) {
+    std::vector<std::vector<std::size_t>> d(a.size() + 1, std::vector<std::size_t>(b.size() + 1));
+
+    for (std::size_t i = 0; i <= a.size(); i++) {
+        for (std::size_t j = 0; j <= b.size(); j++) {
+            if (i == 0 || j == 0) {
+                d[i][j] = i + j;
+            } else {
+                d[i][j] = std::min({ d[i - 1][j] + 1, d[i][j - 1] + 1,
+                                     d[i - 1][j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1) });
+            }
+        }
+    }
+
+    return d[a.size()][b.size()];
+}
+
+TEST(Distance, EditDistance) {
+    std::mt19937 rng(7);
+
+    // Lengths around the 64 tokens of the bit-parallel algorithm, few symbols to get matches
+    for (int run = 0; run < 2000; run++) {
+        std::uniform_int_distribution<std::size_t> length(0, run % 2 == 0 ? 20 : 80);
+        std::uniform_int_distribution<std::uint32_t> token(0, run % 3 == 0 ? 3 : 12);
+        std::vector<std::uint32_t> a(length(rng));
+        std::vector<std::uint32_t> b(length(rng));
+
+        // Tokens are hashes, the high bits must be handled
+        for (auto& t: a) {
+            t = token(rng) * 0x9E3779B9U;
+        }
+
+        for (auto& t: b) {
+            t = token(rng) * 0x9E3779B9U;
+        }
+
+        std::size_t expected = reference_edit_distance(a, b);
+        UNSIGNED_LONGS_EQUAL(expected, editDistance(a, b));
+
+        // Past the threshold, max + 1 is returned
+        std::size_t max = run % 10;
+        UNSIGNED_LONGS_EQUAL(std::min(expected, max + 1), editDistance(a, b, max));
+    }
+
+    // Over 64 tokens, a max between the lowest value of the last row (5) and the distance (10)
+    std::vector<std::uint32_t> a(70);
+    std::vector<std::uint32_t> b;
+
+    for (std::uint32_t i = 0; i < a.size(); i++) {
+        a[i] = i * 0x9E3779B9U;
+    }
+
+    b.assign(a.begin() + 5, a.end());
+
+    for (std::uint32_t i = 0; i < 5; i++) {
+        b.push_back((100 + i) * 0x9E3779B9U);
+    }
+
+    UNSIGNED_LONGS_EQUAL(10, reference_edit_distance(a, b));
+    UNSIGNED_LONGS_EQUAL(10, editDistance(a, b));
+
+    for (std::size_t max = 5; max < 10; max++) {
+        UNSIGNED_LONGS_EQUAL(max + 1, editDistance(a, b, max));
+    }
+
+    UNSIGNED_LONGS_EQUAL(10, editDistance(a, b, 10));
+}
+
+TEST(Distance, Modes) {
+    Fingerprint full("1.0|2|0.5|||||GE|1|ho,co,ac|co:ke-al/ac:f159e9d0|||", FULL_FEATURES);
+    Fingerprint coarse("1.0|1|0.5||||||1|ho,co,ac|co:ke-al/ac:f159e9d0|||", FULL_FEATURES);
+    Fingerprint other("1|2|0|||GE|1|ho,ac|co:ke-al|||", FEATURESET[2]);
+
+    // The fingerprints can be compared over any features they both hold
+    DOUBLES_EQUAL(0, distance(full, full), TOLERANCE);
+    // Directory count: |2 - 1| / 2, method: empty
+    DOUBLES_EQUAL(1.5 / 14, distance(full, coarse), TOLERANCE);
+    DOUBLES_EQUAL(0, distance(full, coarse, FEATURESET[3]), TOLERANCE);
+
+    CHECK_THROWS(std::invalid_argument, distance(full, other));
+    CHECK_THROWS(std::invalid_argument, distance(full, other, FULL_FEATURES));
+}
+
+TEST(Distance, Dataset) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<Fingerprint> fingerprints;
+    std::vector<std::string> texts;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "fingerprint" })) {
+            texts.push_back(entry["fingerprint"].get<std::string>());
+            fingerprints.emplace_back(texts.back(), FULL_FEATURES);
+        }
+    }
+
+    CHECK(!fingerprints.empty());
+
+    for (std::size_t i = 0; i < fingerprints.size(); i++) {
+        DOUBLES_EQUAL(0, distance(fingerprints[i], fingerprints[i]), TOLERANCE);
+
+        for (std::size_t j = i + 1; j < fingerprints.size(); j++) {
+            double d = distance(fingerprints[i], fingerprints[j]);
+
+            CHECK(d >= 0 && d <= 1);
+            DOUBLES_EQUAL(d, distance(fingerprints[j], fingerprints[i]), TOLERANCE);
+            DOUBLES_EQUAL(d, distance(texts[i], texts[j], FULL_FEATURES), TOLERANCE);
+        }
+    }
+
+    // Triangle inequality, the metric indexes rely on it
+    for (const Fingerprint& a: fingerprints) {
+        for (const Fingerprint& b: fingerprints) {
+            double ab = distance(a, b);
+
+            for (const Fingerprint& c: fingerprints) {
+                CHECK(distance(a, c) <= ab + distance(b, c) + TOLERANCE);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
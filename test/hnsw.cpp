@@ -0,0 +1,171 @@
+/**
+ * @file hnsw.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the HNSW graph
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <finger/hnsw.hpp>
+#include <finger/modes.hpp>
+#include <test/dataset.hpp>
+#include <thread>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+static constexpr double TOLERANCE = 1e-9;
+
+/**
+ * @brief Share of the true k nearest neighbours found, ties counting as found
+ */
+static double recall(const HNSWIndex& index, const FingerprintTable& table,
+                     const std::vector<std::string>& queries, std::size_t k) {
+    std::vector<double> all(table.size());
+    std::size_t found = 0;
+
+    for (const std::string& text: queries) {
+        Fingerprint query(text, FULL_FEATURES);
+        std::vector<TableMatch> matches = index.knn(query, k);
+
+        table.distances(query, all);
+        std::nth_element(all.begin(), all.begin() + k - 1, all.end());
+
+        UNSIGNED_LONGS_EQUAL(k, matches.size());
+
+        for (std::size_t i = 0; i < matches.size(); i++) {
+            CHECK(i == 0 || matches[i - 1].distance <= matches[i].distance);
+            DOUBLES_EQUAL(distance(query, Fingerprint(index.text(matches[i].row), FULL_FEATURES)),
+                          matches[i].distance, TOLERANCE);
+            found += matches[i].distance <= all[k - 1] + 1e-6 ? 1 : 0;
+        }
+    }
+
+    return static_cast<double>(found) / static_cast<double>(queries.size() * k);
+}
+
+TEST_GROUP(HNSW) {};
+
+TEST(HNSW, Recall) {
+    std::vector<std::string> fingerprints = dataset_references(5000, 1);
+    std::vector<std::string> queries = dataset_references(100, 2);
+    HNSWIndex index(FULL_FEATURES, fingerprints.size());
+    FingerprintTable table(FULL_FEATURES);
+
+    for (std::size_t i = 0; i < fingerprints.size(); i++) {
+        UNSIGNED_LONGS_EQUAL(i, index.add(fingerprints[i]));
+        table.add(Fingerprint(fingerprints[i], FULL_FEATURES));
+    }
+
+    UNSIGNED_LONGS_EQUAL(fingerprints.size(), index.size());
+    CHECK(recall(index, table, queries, 10) >= 0.95);
+
+    // The references are found themselves
+    for (std::size_t i = 0; i < fingerprints.size(); i += 101) {
+        Fingerprint query(fingerprints[i], FULL_FEATURES);
+        DOUBLES_EQUAL(0, index.knn(query, 1)[0].distance, TOLERANCE);
+    }
+
+    // A wider search finds more neighbours
+    std::vector<Fingerprint> parsed;
+
+    for (const std::string& text: queries) {
+        parsed.emplace_back(text, FULL_FEATURES);
+    }
+
+    std::vector<std::vector<TableMatch>> batch = index.knn(parsed, 10, 0, 4);
+
+    UNSIGNED_LONGS_EQUAL(parsed.size(), batch.size());
+
+    for (std::size_t q = 0; q < parsed.size(); q++) {
+        std::vector<TableMatch> single = index.knn(parsed[q], 10);
+        std::vector<TableMatch> wide = index.knn(parsed[q], 10, 200);
+
+        UNSIGNED_LONGS_EQUAL(single.size(), batch[q].size());
+
+        for (std::size_t i = 0; i < single.size(); i++) {
+            UNSIGNED_LONGS_EQUAL(single[i].row, batch[q][i].row);
+            CHECK(wide[i].distance <= single[i].distance + TOLERANCE);
+        }
+    }
+}
+
+TEST(HNSW, ConcurrentInserts) {
+    std::vector<std::string> fingerprints = dataset_references(4000, 3);
+    std::vector<std::string> queries = dataset_references(100, 4);
+    HNSWIndex index(FULL_FEATURES, fingerprints.size());
+    FingerprintTable table(FULL_FEATURES);
+    std::vector<std::thread> threads;
+
+    for (const std::string& fp: fingerprints) {
+        table.add(Fingerprint(fp, FULL_FEATURES));
+    }
+
+    // Four writers, and a reader querying the index meanwhile
+    for (std::size_t t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = t; i < fingerprints.size(); i += 4) {
+                index.add(fingerprints[i]);
+            }
+        });
+    }
+
+    threads.emplace_back([&]() {
+        for (const std::string& text: queries) {
+            index.knn(Fingerprint(text, FULL_FEATURES), 10);
+        }
+    });
+
+    for (std::thread& t: threads) {
+        t.join();
+    }
+
+    UNSIGNED_LONGS_EQUAL(fingerprints.size(), index.size());
+
+    // Every fingerprint is in the index once
+    std::vector<std::string> texts;
+
+    for (std::size_t id = 0; id < index.size(); id++) {
+        texts.push_back(index.text(id));
+    }
+
+    std::sort(texts.begin(), texts.end());
+    std::sort(fingerprints.begin(), fingerprints.end());
+    CHECK(texts == fingerprints);
+
+    CHECK(recall(index, table, queries, 10) >= 0.95);
+}
+
+TEST(HNSW, Errors) {
+    HNSWParams params;
+    params.m = 1;
+    CHECK_THROWS(std::invalid_argument, HNSWIndex(FULL_FEATURES, 10, params));
+
+    // Rejected before the nodes are allocated
+    CHECK_THROWS(std::invalid_argument, HNSWIndex(FULL_FEATURES, 0xFFFFFFFF));
+    CHECK_THROWS(std::invalid_argument, HNSWIndex(FULL_FEATURES, ~std::size_t(0)));
+
+    HNSWIndex index(FEATURESET[3], 2);
+    CHECK(index.knn(Fingerprint("1|1||0|ho,co", FEATURESET[3]), 5).empty());
+
+    // Not matching the mode, the fingerprint takes no ID
+    CHECK_THROWS(std::invalid_argument, index.add("1|2"));
+    UNSIGNED_LONGS_EQUAL(0, index.size());
+
+    index.add("1|1||0|ho,co");
+    index.add("1|1||0|ho,ac");
+    CHECK_THROWS(std::length_error, index.add("1|1||0|ho"));
+    UNSIGNED_LONGS_EQUAL(2, index.size());
+
+    std::vector<TableMatch> matches = index.knn(Fingerprint("1|1||0|ho,co", FEATURESET[3]), 5);
+    UNSIGNED_LONGS_EQUAL(2, matches.size());
+    UNSIGNED_LONGS_EQUAL(0, matches[0].row);
+    DOUBLES_EQUAL(0, matches[0].distance, TOLERANCE);
+
+    Fingerprint other("2|1|s|1|ho|x|1", FEATURESET[0]);
+    CHECK_THROWS(std::invalid_argument, index.knn(other, 5));
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
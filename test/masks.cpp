@@ -0,0 +1,179 @@
+/**
+ * @file masks.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the bitmasks of the known headers and values of a request
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <finger/distance.hpp>
+#include <finger/fingerprint.hpp>
+#include <finger/masks.hpp>
+#include <finger/modes.hpp>
+#include <finger/tables.hpp>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+static constexpr double TOLERANCE = 1e-9;
+
+TEST_GROUP(Masks) {
+    TEST_TEARDOWN() { config_reset(); }
+};
+
+TEST(Masks, HeaderMasks) {
+    HeaderMasks masks =
+    header_masks({ "Host: localhost", "accept: */*", "X-Custom: 1", "User-Agent: curl" });
+
+    std::uint64_t host = std::uint64_t(1) << HEADERS.index("host");
+    std::uint64_t accept = std::uint64_t(1) << HEADERS.index("accept");
+    std::uint64_t ua = std::uint64_t(1) << HEADERS.index("user-agent");
+
+    // Unknown headers are left out
+    UNSIGNED_LONGS_EQUAL(host | accept | ua, masks.presence);
+    UNSIGNED_LONGS_EQUAL(host | ua, masks.uppercase);
+
+    // Same masks from the header order of the fingerprint
+    CHECK(masks == orderMasks("ho,!ac,8d6c5e7b,us-ag"));
+    CHECK(HeaderMasks() == header_masks({}));
+}
+
+TEST(Masks, Similarity) {
+    DOUBLES_EQUAL(1, maskJaccard(0, 0), TOLERANCE);
+    DOUBLES_EQUAL(1, maskJaccard(0b1011, 0b1011), TOLERANCE);
+    DOUBLES_EQUAL(1. / 3, maskJaccard(0b0011, 0b0110), TOLERANCE);
+    DOUBLES_EQUAL(0, maskJaccard(0b0001, 0b0010), TOLERANCE);
+
+    LONGS_EQUAL(0, maskHamming(0b1011, 0b1011));
+    LONGS_EQUAL(2, maskHamming(0b0011, 0b0110));
+    LONGS_EQUAL(64, maskHamming(0, ~std::uint64_t(0)));
+}
+
+TEST(Masks, ValueBits) {
+    std::vector<std::string> headers = { "Accept-Encoding: gzip, deflate, br",
+                                         "Connection: keep-alive",
+                                         "Cache-Control: max-age=0",
+                                         "TE: gzip;q=1.0, trailers",
+                                         "Accept-Charset: utf-8" };
+    ValueBits bits = value_bits(headers);
+
+    auto token = [](std::size_t h, std::string_view key) {
+        return static_cast<std::uint16_t>(1U << ((*ConfigGuard()).*VALUE_TABLES[h]).index(key));
+    };
+
+    // Accept-Encoding, Connection and Accept-Charset are sets of known tokens
+    LONGS_EQUAL(0b100011, bits.known);
+    LONGS_EQUAL(token(0, "gzip") | token(0, "deflate") | token(0, "br"), bits.bits[0]);
+    LONGS_EQUAL(token(1, "keep-alive"), bits.bits[1]);
+    LONGS_EQUAL(token(5, "utf-8"), bits.bits[5]);
+
+    // Unknown token, quality parameter
+    LONGS_EQUAL(0b011000, bits.unknown);
+
+    // Same bits from the header values of the fingerprint
+    std::string values = header_fingerprint(headers);
+    CHECK(bits == valuesBits(values.substr(values.find('|') + 1)));
+
+    // A second value of a header is merged, unless it has unknown tokens
+    std::vector<std::string> twice = { "Accept-Encoding: gzip", "Accept-Encoding: br" };
+    LONGS_EQUAL(token(0, "gzip") | token(0, "br"), value_bits(twice).bits[0]);
+    twice.emplace_back("Accept-Encoding: zstd");
+    LONGS_EQUAL(0, value_bits(twice).known);
+    LONGS_EQUAL(1, value_bits(twice).unknown);
+}
+
+TEST(Masks, ValueSimilarity) {
+    ValueBits a = value_bits({ "Accept-Encoding: gzip, deflate", "Connection: close" });
+    ValueBits b = value_bits({ "Accept-Encoding: gzip, br", "Connection: close" });
+    ValueBits c = value_bits({ "Accept-Encoding: gzip, deflate", "TE: x-custom" });
+
+    DOUBLES_EQUAL(1, valueSimilarity(a, a), TOLERANCE);
+    DOUBLES_EQUAL((1. / 3 + 1) / 2, valueSimilarity(a, b), TOLERANCE);
+
+    // Connection only in a, TE unknown only in c
+    DOUBLES_EQUAL(1. / 3, valueSimilarity(a, c), TOLERANCE);
+
+    // Unknown values in both requests are left out
+    DOUBLES_EQUAL(1, valueSimilarity(c, c), TOLERANCE);
+    DOUBLES_EQUAL(1, valueSimilarity(ValueBits(), ValueBits()), TOLERANCE);
+}
+
+TEST(Masks, LoadedTables) {
+    std::vector<std::string> headers = { "Host: localhost", "X-Custom: 1", "user-agent: curl",
+                                         "Accept-Encoding: zstd, gzip", "Connection: close" };
+
+    // Header bits in the order of the loaded table, sorted by name, and tokens of the loaded
+    // value table only
+    config_load({ { "HEADERS", { { "x-custom", "x-cu" }, { "host", "ho" }, { "user-agent", "us" },
+                                 { "accept-encoding", "ac-en" } } },
+                  { "AE", { { "zstd", "zs" }, { "gzip", "gz" } } } });
+
+    HeaderMasks masks = header_masks(headers);
+    ValueBits bits = value_bits(headers);
+
+    LONGS_EQUAL(0b1111, masks.presence);
+    LONGS_EQUAL(0b1011, masks.uppercase);
+    LONGS_EQUAL(0b11, bits.bits[0]);
+
+    // Connection has no code in the loaded headers table, its value cannot be told apart
+    LONGS_EQUAL(0b1, bits.known);
+
+    // Same masks from the fingerprint computed with the same tables
+    std::string values = header_fingerprint(headers);
+    CHECK(masks == orderMasks(values.substr(0, values.find('|'))));
+    CHECK(bits == valuesBits(values.substr(values.find('|') + 1)));
+
+    // Headers and tokens past the bits of the masks are left out
+    nlohmann::json many = { { "accept-encoding", "ac-en" } };
+    nlohmann::json tokens = nlohmann::json::object();
+
+    for (int i = 0; i < 70; i++) {
+        many["h" + std::to_string(100 + i)] = "h" + std::to_string(i);
+        tokens["t" + std::to_string(100 + i)] = "t" + std::to_string(i);
+    }
+
+    config_load({ { "HEADERS", many }, { "AE", tokens } });
+
+    std::vector<std::string> far = { "H100: a", "H162: b", "H163: c" };
+    std::string order = header_fingerprint(far);
+
+    CHECK(header_masks(far).presence == (std::uint64_t(1) << 63U | 0b10));
+    CHECK(header_masks(far) == orderMasks(order.substr(0, order.find('|'))));
+    LONGS_EQUAL(1, value_bits({ "Accept-Encoding: t115" }).known);
+    LONGS_EQUAL(0, value_bits({ "Accept-Encoding: t116" }).known);
+}
+
+TEST(Masks, Dataset) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::size_t count = 0;
+
+    for (auto& entry: set) {
+        if (!dataset_contains(
+            entry, { "uri", "method", "version", "headers", "payload", "fingerprint" })) {
+            continue;
+        }
+
+        HTTPRequest req(entry["uri"].get<std::string>(),
+                        entry["method"].get<std::string>(),
+                        entry["version"].get<std::string>(),
+                        entry["headers"].get<std::vector<std::string>>(),
+                        entry["payload"].get<std::string>());
+        HeaderMasks masks = header_masks(req.headers);
+
+        // Computed from the request, and from the fingerprint
+        CHECK(masks ==
+              Fingerprint(entry["fingerprint"].get<std::string>(), FULL_FEATURES).headerMasks());
+        CHECK((masks.uppercase & ~masks.presence) == 0);
+
+        ValueBits bits = value_bits(req.headers);
+        CHECK(bits ==
+              Fingerprint(entry["fingerprint"].get<std::string>(), FULL_FEATURES).valueBits());
+        count++;
+    }
+
+    CHECK(count > 0);
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
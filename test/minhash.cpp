@@ -0,0 +1,226 @@
+/**
+ * @file minhash.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the MinHash signatures of the header tokens and of their LSH index
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <cmath>
+#include <finger/fingerprint.hpp>
+#include <finger/minhash.hpp>
+#include <iterator>
+#include <random>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+/**
+ * @brief Exact Jaccard similarity of two sorted token sets
+ */
+static double jaccard(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>& b) {
+    std::vector<std::uint64_t> common;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(common));
+
+    return static_cast<double>(common.size()) /
+           static_cast<double>(a.size() + b.size() - common.size());
+}
+
+TEST_GROUP(MinHash) {};
+
+TEST(MinHash, Signatures) {
+    std::mt19937_64 rng(1);
+
+    // 100 shared tokens, and 0 to 100 tokens of each set alone
+    for (std::size_t own: { 0, 10, 25, 50, 100 }) {
+        std::vector<std::uint64_t> a;
+        std::vector<std::uint64_t> b;
+
+        for (std::size_t i = 0; i < 100; i++) {
+            std::uint64_t token = rng();
+            a.push_back(token);
+            b.push_back(token);
+        }
+
+        for (std::size_t i = 0; i < own; i++) {
+            a.push_back(rng());
+            b.push_back(rng());
+        }
+
+        double expected = 100.0 / static_cast<double>(100 + 2 * own);
+        double estimate = minhashSimilarity(minhash(a, 512), minhash(b, 512));
+
+        DOUBLES_EQUAL(expected, estimate, 0.06);
+    }
+
+    // Duplicates and order do not matter
+    std::vector<std::uint64_t> tokens = { 3, 1, 2 };
+    CHECK(minhash(tokens, 64) == minhash(std::vector<std::uint64_t> { 1, 2, 3, 3, 1 }, 64));
+
+    // Empty sets
+    std::vector<std::uint32_t> empty = minhash({}, 16);
+    UNSIGNED_LONGS_EQUAL(16, empty.size());
+    CHECK(std::all_of(empty.begin(), empty.end(),
+                      [](std::uint32_t h) { return h == 0xFFFFFFFF; }));
+    DOUBLES_EQUAL(1, minhashSimilarity({}, empty), 0);
+}
+
+TEST(MinHash, HeaderTokens) {
+    Fingerprint fp("1.0|2|0.5|||||GE|1|ho,co,ac,us-ag|co:ke-al/ac:f159e9d0|||", FULL_FEATURES);
+    std::vector<std::uint64_t> tokens = headerTokens(fp);
+
+    // Four header names and two values
+    UNSIGNED_LONGS_EQUAL(6, tokens.size());
+    CHECK(std::is_sorted(tokens.begin(), tokens.end()));
+
+    // The header order and values of the request, as in its fingerprint
+    std::vector<std::string> headers = { "Host: localhost", "Connection: keep-alive",
+                                         "Accept: */*", "User-Agent: curl" };
+    std::vector<std::uint64_t> request = header_tokens(headers);
+    std::string full = "1.0|2|0.5|||||GE|1|" + header_fingerprint(headers) + "|||";
+
+    CHECK(request == headerTokens(Fingerprint(full, FULL_FEATURES)));
+
+    // One header more adds its name, and its value if not already there
+    headers.emplace_back("Accept-Encoding: gzip");
+    std::vector<std::uint64_t> more = header_tokens(headers);
+
+    CHECK(more.size() > request.size() && more.size() <= request.size() + 2);
+    CHECK(std::includes(more.begin(), more.end(), request.begin(), request.end()));
+
+    CHECK(headerTokens(Fingerprint("1|1||0|", FEATURESET[3])).empty());
+}
+
+/**
+ * @brief Header lines of the dataset, one set per request
+ */
+static std::vector<std::vector<std::string>> datasetHeaders() {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::vector<std::string>> requests;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "headers" })) {
+            requests.push_back(entry["headers"].get<std::vector<std::string>>());
+        }
+    }
+
+    return requests;
+}
+
+TEST(MinHash, Index) {
+    std::vector<std::vector<std::string>> requests = datasetHeaders();
+    std::vector<std::vector<std::uint64_t>> sets;
+    std::mt19937 rng(7);
+
+    // The dataset requests, and variants with one or two headers dropped
+    for (const std::vector<std::string>& headers: requests) {
+        sets.push_back(header_tokens(headers));
+
+        for (std::size_t dropped: { 1, 2 }) {
+            std::vector<std::string> variant = headers;
+
+            for (std::size_t d = 0; d < dropped && variant.size() > 1; d++) {
+                variant.erase(variant.begin() + static_cast<long>(rng() % variant.size()));
+            }
+
+            sets.push_back(header_tokens(variant));
+        }
+    }
+
+    MinHashIndex index(0.6);
+
+    CHECK(index.hashes() <= 128);
+    UNSIGNED_LONGS_EQUAL(index.bands() * index.rows(), index.hashes());
+
+    std::vector<std::vector<std::uint32_t>> signatures;
+
+    for (const std::vector<std::uint64_t>& tokens: sets) {
+        signatures.push_back(minhash(tokens, index.hashes()));
+        UNSIGNED_LONGS_EQUAL(signatures.size() - 1, index.add(signatures.back()));
+    }
+
+    UNSIGNED_LONGS_EQUAL(sets.size(), index.size());
+
+    std::size_t similar = 0;
+    std::size_t found = 0;
+
+    for (std::size_t q = 0; q < sets.size(); q++) {
+        std::vector<JaccardMatch> matches = index.similar(signatures[q]);
+
+        // The query itself, then matches above the threshold, by decreasing similarity
+        CHECK(!matches.empty());
+        DOUBLES_EQUAL(1, matches[0].similarity, 0);
+
+        for (std::size_t i = 0; i < matches.size(); i++) {
+            CHECK(matches[i].similarity >= index.threshold());
+            CHECK(i == 0 || matches[i - 1].similarity >= matches[i].similarity);
+            DOUBLES_EQUAL(minhashSimilarity(signatures[q], signatures[matches[i].row]),
+                          matches[i].similarity, 0);
+        }
+
+        // Sets well above the threshold are found
+        for (std::size_t r = 0; r < sets.size(); r++) {
+            if (jaccard(sets[q], sets[r]) >= 0.8) {
+                similar++;
+                found += std::any_of(matches.begin(), matches.end(),
+                                     [&](const JaccardMatch& m) { return m.row == r; })
+                         ? 1
+                         : 0;
+            }
+        }
+    }
+
+    CHECK(static_cast<double>(found) >= 0.95 * static_cast<double>(similar));
+
+    // Unrelated sets are not candidates
+    std::mt19937_64 tokens(3);
+    std::size_t candidates = 0;
+
+    for (std::size_t q = 0; q < 100; q++) {
+        std::vector<std::uint64_t> other;
+
+        for (std::size_t t = 0; t < 20; t++) {
+            other.push_back(tokens());
+        }
+
+        candidates += index.candidates(minhash(other, index.hashes())).size();
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, candidates);
+}
+
+TEST(MinHash, Bands) {
+    // The S-curve rises at the threshold or just below it
+    for (double threshold: { 0.3, 0.5, 0.8, 0.9 }) {
+        MinHashIndex index(threshold);
+        auto bands = static_cast<double>(index.bands());
+        auto rows = static_cast<double>(index.rows());
+
+        CHECK(std::pow(1 / bands, 1 / rows) <= threshold);
+        CHECK(std::pow(1 / bands, 1 / rows) > threshold - 0.1);
+    }
+
+    MinHashIndex exact(1, 4, 8);
+    UNSIGNED_LONGS_EQUAL(32, exact.hashes());
+
+    std::vector<std::uint32_t> signature = minhash(std::vector<std::uint64_t> { 1, 2 }, 32);
+    std::vector<std::uint32_t> longer = minhash(std::vector<std::uint64_t> { 1, 2 }, 40);
+
+    exact.add(signature);
+    UNSIGNED_LONGS_EQUAL(1, exact.add(longer));
+    CHECK(std::equal(signature.begin(), signature.end(), exact.signature(1).begin()));
+    UNSIGNED_LONGS_EQUAL(2, exact.similar(signature).size());
+    CHECK(exact.similar(minhash(std::vector<std::uint64_t> { 1, 3 }, 32)).empty());
+
+    CHECK_THROWS(std::invalid_argument, exact.add(minhash({}, 31)));
+    CHECK_THROWS(std::invalid_argument, exact.similar(minhash({}, 31)));
+    CHECK_THROWS(std::invalid_argument, MinHashIndex(0));
+    CHECK_THROWS(std::invalid_argument, MinHashIndex(1.5));
+    CHECK_THROWS(std::invalid_argument, MinHashIndex(0.5, 0));
+    CHECK_THROWS(std::invalid_argument, MinHashIndex(0.5, 0, 4));
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
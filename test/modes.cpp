@@ -0,0 +1,120 @@
+/**
+ * @file modes.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the fingerprints restricted to the features of a mode
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <boost/algorithm/string.hpp>
+#include <finger/fingerprint.hpp>
+#include <finger/modes.hpp>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+/**
+ * @brief Requests of the full dataset along with their expected fingerprint
+ */
+static std::vector<std::pair<HTTPRequest, std::string>> load_requests() {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::pair<HTTPRequest, std::string>> requests;
+
+    for (auto& entry: set) {
+        if (!dataset_contains(
+            entry, { "uri", "method", "version", "headers", "payload", "fingerprint" })) {
+            continue;
+        }
+
+        requests.emplace_back(HTTPRequest(entry["uri"].get<std::string>(),
+                                          entry["method"].get<std::string>(),
+                                          entry["version"].get<std::string>(),
+                                          entry["headers"].get<std::vector<std::string>>(),
+                                          entry["payload"].get<std::string>()),
+                              entry["fingerprint"].get<std::string>());
+    }
+
+    return requests;
+}
+
+/**
+ * @brief Checks that the mode fingerprint holds the used features of the full fingerprint, the
+ * float features of the 'i' type being rounded
+ */
+static void check_projection(const FeatureTypes& features,
+                             const std::string& full,
+                             const std::string& projected) {
+    std::vector<std::string> expected;
+    std::vector<std::string> fields;
+    boost::split(expected, full, boost::is_any_of("|"));
+    boost::split(fields, projected, boost::is_any_of("|"));
+
+    std::size_t f = 0;
+
+    for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+        if (features[i] == 0) {
+            continue;
+        }
+
+        bool rounded = features[i] == 'i' && expected[i].find('.') != std::string::npos;
+
+        if (rounded) {
+            DOUBLES_EQUAL(std::stof(expected[i]), std::stof(fields[f]), 0.55);
+        } else {
+            STRCMP_EQUAL(expected[i].c_str(), fields[f].c_str());
+        }
+
+        f++;
+    }
+
+    UNSIGNED_LONGS_EQUAL(f, fields.size());
+}
+
+TEST_GROUP(Modes) {};
+
+TEST(Modes, FullFeatures) {
+    for (auto& [req, expected]: load_requests()) {
+        STRCMP_EQUAL(expected.c_str(), fingerprint<FULL_FEATURES>(req).c_str());
+    }
+}
+
+TEST(Modes, FeatureSetModes) {
+    for (auto& [req, expected]: load_requests()) {
+        check_projection(FEATURESET[0], expected, fingerprint<0>(req));
+        check_projection(FEATURESET[1], expected, fingerprint<1>(req));
+        check_projection(FEATURESET[2], expected, fingerprint<2>(req));
+        check_projection(FEATURESET[3], expected, fingerprint<3>(req));
+        check_projection(FEATURESET[4], expected, fingerprint<4>(req));
+    }
+}
+
+TEST(Modes, CustomMode) {
+    static constexpr FeatureTypes LIGHT = {
+        'f', 'i', 'f', 0, 'f', 'i', 'f', 's', 's', 's', 's', 0, 0, 0,
+    };
+
+    for (auto& [req, expected]: load_requests()) {
+        check_projection(LIGHT, expected, fingerprint<LIGHT>(req));
+    }
+}
+
+TEST(Modes, SeveralModes) {
+    static constexpr FeatureTypes COARSE = { 0, 'i', 0, 's', 0, 0, 0, 's', 's', 's', 0, 0, 0, 0 };
+
+    for (auto& [req, expected]: load_requests()) {
+        auto [coarse, full] = fingerprints<COARSE, FULL_FEATURES>(req);
+
+        STRCMP_EQUAL(fingerprint<COARSE>(req).c_str(), coarse.c_str());
+        STRCMP_EQUAL(expected.c_str(), full.c_str());
+
+        auto modes = fingerprints<0, 1, 2, 3, 4>(req);
+
+        STRCMP_EQUAL(fingerprint<0>(req).c_str(), modes[0].c_str());
+        STRCMP_EQUAL(fingerprint<3>(req).c_str(), modes[3].c_str());
+        STRCMP_EQUAL(fingerprint<4>(req).c_str(), modes[4].c_str());
+    }
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
@@ -0,0 +1,173 @@
+/**
+ * @file payload.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the payload fingerprinting
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <fcntl.h>
+#include <finger/fingerprint.hpp>
+#include <finger/payload.hpp>
+#include <test/dataset.hpp>
+#include <unistd.h>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+TEST_GROUP(Payload) {};
+
+TEST(Payload, AccumulatorChunks) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+
+    for (auto& entry: set) {
+        if (!dataset_contains(entry, { "payload" })) {
+            continue;
+        }
+
+        std::string payload = entry["payload"].get<std::string>();
+        std::string expected = payload_fingerprint(payload);
+
+        for (std::size_t chunk_size: { 1, 7, 4096 }) {
+            PayloadAccumulator acc;
+
+            for (std::size_t i = 0; i < payload.size(); i += chunk_size) {
+                acc.update(std::string_view(payload).substr(i, chunk_size));
+            }
+
+            STRCMP_EQUAL(expected.c_str(), acc.finish().c_str());
+        }
+    }
+}
+
+TEST(Payload, AccumulatorReset) {
+    PayloadAccumulator acc;
+
+    acc.update("abcd");
+    STRCMP_EQUAL(payload_fingerprint("abcd").c_str(), acc.finish().c_str());
+
+    acc.reset();
+    STRCMP_EQUAL("||", acc.finish().c_str());
+}
+
+TEST(Payload, SampledEntropy) {
+    EntropySampling sampling;
+    sampling.threshold = 1024;
+    sampling.sample_size = 256;
+    sampling.block_size = 16;
+
+    std::string body;
+
+    for (int i = 0; body.size() < 1024 * 1024; i++) {
+        body += "id=" + std::to_string(i) + "&name=user" + std::to_string(i * 7) + "&";
+    }
+
+    // Under the threshold: exact
+    STRCMP_EQUAL(payload_fingerprint("abcd").c_str(),
+                 payload_fingerprint(std::string_view("abcd"), sampling).c_str());
+
+    // Over the threshold: deterministic, and one tenth away from the exact value at most
+    DOUBLES_EQUAL(entropy(body), sampledEntropy(body, sampling), 0.1 + 1e-6);
+    DOUBLES_EQUAL(sampledEntropy(body, sampling), sampledEntropy(body, sampling), 0);
+
+    // Degenerate settings: blocks of at least a byte and at most the sample
+    sampling.block_size = 0;
+    DOUBLES_EQUAL(entropy(body), sampledEntropy(body, sampling), 0.5);
+
+    sampling.block_size = 4096;
+    DOUBLES_EQUAL(entropy(body), sampledEntropy(body, sampling), 0.5);
+
+    sampling.threshold = 0;
+    sampling.sample_size = 1;
+    CHECK(sampledEntropy(body, sampling) == 0);
+
+    sampling.sample_size = 0;
+    CHECK_THROWS(std::invalid_argument, sampledEntropy(body, sampling));
+    CHECK_THROWS(std::invalid_argument, payload_fingerprint(std::string_view("abcd"), sampling));
+}
+
+TEST(Payload, ChunkedBody) {
+    std::string body = "user=admin&password=hunter2&remember=1";
+    std::string expected = payload_fingerprint(body);
+
+    // Single chunk fast path
+    std::string single = "26\r\n" + body + "\r\n0\r\n\r\n";
+    STRCMP_EQUAL(expected.c_str(), chunked_payload_fingerprint(single).c_str());
+
+    // Several chunks, extension, trailer and bare LF, fed byte per byte
+    std::string chunked = "a;name=value\r\n" + body.substr(0, 10) + "\r\n1c\n" + body.substr(10) +
+    "\n0\r\nExpires: never\r\n\r\n";
+    STRCMP_EQUAL(expected.c_str(), chunked_payload_fingerprint(chunked).c_str());
+
+    PayloadAccumulator acc;
+    ChunkedDecoder decoder(acc);
+    std::string pipelined = chunked + "GET";
+    std::size_t consumed = 0;
+
+    for (std::size_t i = 0; i < pipelined.size(); i++) {
+        consumed += decoder.update(std::string_view(pipelined).substr(i, 1));
+    }
+
+    // The next message is left untouched
+    CHECK(decoder.done());
+    UNSIGNED_LONGS_EQUAL(chunked.size(), consumed);
+    STRCMP_EQUAL(expected.c_str(), acc.finish().c_str());
+
+    CHECK_THROWS(std::invalid_argument, chunked_payload_fingerprint("zz\r\nabc\r\n0\r\n\r\n"));
+    CHECK_THROWS(std::invalid_argument, chunked_payload_fingerprint("3\r\nabcd\r\n0\r\n\r\n"));
+    CHECK_THROWS(std::invalid_argument, chunked_payload_fingerprint("3\r\nabc\r\n"));
+}
+
+TEST(Payload, BinaryPayload) {
+    std::string payload("\x89PNG\r\n\x1a\n\0\0\0\rIHDR\xff\xfe", 19);
+    std::span<const std::byte> bytes = std::as_bytes(std::span(payload));
+    std::string expected = payload_fingerprint(payload);
+
+    STRCMP_EQUAL(expected.c_str(), payload_fingerprint(bytes).c_str());
+
+    PayloadAccumulator acc;
+    acc.update(bytes.first(5));
+    acc.update(bytes.subspan(5));
+    STRCMP_EQUAL(expected.c_str(), acc.finish().c_str());
+
+    // Spooled to disk
+    char path[] = "/tmp/fingerlib-payloadXXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    CHECK(write(fd, payload.data(), payload.size()) == static_cast<ssize_t>(payload.size()));
+    close(fd);
+
+    STRCMP_EQUAL(expected.c_str(), file_payload_fingerprint(path).c_str());
+    UNSIGNED_LONGS_EQUAL(payload.size(), MappedFile(path).size());
+
+    // Large file: exact unless sampling is asked for
+    std::string body;
+
+    for (int i = 0; body.size() < 64 * 1024; i++) {
+        body += "id=" + std::to_string(i) + "&name=user" + std::to_string(i * 7) + "&";
+    }
+
+    EntropySampling sampling;
+    sampling.threshold = 1024;
+    sampling.sample_size = 16;
+    sampling.block_size = 16;
+
+    fd = open(path, O_WRONLY | O_TRUNC);
+    CHECK(write(fd, body.data(), body.size()) == static_cast<ssize_t>(body.size()));
+    close(fd);
+
+    STRCMP_EQUAL(payload_fingerprint(body).c_str(), file_payload_fingerprint(path).c_str());
+    STRCMP_EQUAL(payload_fingerprint(std::string_view(body), sampling).c_str(),
+                 file_payload_fingerprint(path, sampling).c_str());
+
+    // Empty file
+    fd = open(path, O_WRONLY | O_TRUNC);
+    close(fd);
+    STRCMP_EQUAL("||", file_payload_fingerprint(path).c_str());
+
+    unlink(path);
+    CHECK_THROWS(std::system_error, file_payload_fingerprint(path));
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
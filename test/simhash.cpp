@@ -0,0 +1,153 @@
+/**
+ * @file simhash.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the SimHash signatures and of their Hamming search index
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <array>
+#include <bit>
+#include <finger/modes.hpp>
+#include <finger/simhash.hpp>
+#include <random>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+TEST_GROUP(SimHash) {};
+
+TEST(SimHash, Signatures) {
+    const char* fp = "1.0|2|0.5|||||GE|1|ho,co,ac,us-ag,ac-en|co:ke-al/ac:f159e9d0|||";
+    std::uint64_t signature = simhash(fp, FULL_FEATURES);
+
+    CHECK(signature != 0);
+    UNSIGNED_LONGS_EQUAL(signature, simhash(Fingerprint(fp, FULL_FEATURES)));
+
+    // Payload features give no token
+    UNSIGNED_LONGS_EQUAL(signature,
+                         simhash("1.0|2|0.5|||||GE|1|ho,co,ac,us-ag,ac-en|co:ke-al/ac:f159e9d0|1|"
+                                 "3.2|2.1",
+                                 FULL_FEATURES));
+
+    // Numbers are rounded
+    UNSIGNED_LONGS_EQUAL(signature,
+                         simhash("1.2|2|0.5|||||GE|1|ho,co,ac,us-ag,ac-en|co:ke-al/ac:f159e9d0|||",
+                                 FULL_FEATURES));
+
+    // Close fingerprints get close signatures
+    std::uint64_t swapped =
+    simhash("1.0|2|0.5|||||GE|1|ho,ac,co,us-ag,ac-en|co:ke-al/ac:f159e9d0|||", FULL_FEATURES);
+    std::uint64_t other = simhash("3.0|0|1.5|ph||||PO|2|us-ag,ho|ac:te/ht|||", FULL_FEATURES);
+
+    CHECK(std::popcount(signature ^ swapped) < std::popcount(signature ^ other));
+
+    // No token
+    UNSIGNED_LONGS_EQUAL(0, simhash("|||||||||||||", FULL_FEATURES));
+    CHECK_THROWS(std::invalid_argument, simhash("1|2", FULL_FEATURES));
+}
+
+/**
+ * @brief Drops headers of the header order of a fingerprint, after the first one
+ */
+static std::string dropHeaders(std::string fp, int count) {
+    for (int i = 0; i < count; i++) {
+        std::size_t comma = fp.find(',');
+
+        if (comma != std::string::npos) {
+            fp.erase(comma, fp.find_first_of(",|", comma + 1) - comma);
+        }
+    }
+
+    return fp;
+}
+
+TEST(SimHash, Dataset) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::string> fingerprints;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "fingerprint" })) {
+            fingerprints.push_back(entry["fingerprint"].get<std::string>());
+        }
+    }
+
+    // The signatures move away as headers are dropped, unrelated signatures are 32 bits apart
+    std::array<double, 3> mean {};
+    constexpr std::array<int, 3> DROPPED = { 1, 3, 6 };
+
+    for (const std::string& fp: fingerprints) {
+        std::uint64_t signature = simhash(fp, FULL_FEATURES);
+
+        for (std::size_t d = 0; d < DROPPED.size(); d++) {
+            std::uint64_t dropped = simhash(dropHeaders(fp, DROPPED[d]), FULL_FEATURES);
+            mean[d] += std::popcount(signature ^ dropped);
+        }
+    }
+
+    for (double& m: mean) {
+        m /= static_cast<double>(fingerprints.size());
+    }
+
+    CHECK(mean[0] < mean[1] && mean[1] < mean[2]);
+    CHECK(mean[0] < 12);
+}
+
+TEST(SimHash, Index) {
+    std::mt19937_64 rng(5);
+    std::vector<std::uint64_t> signatures;
+
+    // Clusters of signatures a few bits apart
+    for (int c = 0; c < 200; c++) {
+        std::uint64_t center = rng();
+
+        for (int i = 0; i < 20; i++) {
+            std::uint64_t signature = center;
+
+            for (std::uint64_t flips = rng() % 8; flips > 0; flips--) {
+                signature ^= std::uint64_t(1) << (rng() % 64);
+            }
+
+            signatures.push_back(signature);
+        }
+    }
+
+    for (int k: { 0, 1, 3, 6, 10 }) {
+        SimHashIndex index(signatures, k);
+
+        UNSIGNED_LONGS_EQUAL(signatures.size(), index.size());
+
+        for (std::size_t q = 0; q < signatures.size(); q += 37) {
+            std::uint64_t query = signatures[q] ^ (std::uint64_t(1) << (q % 64));
+
+            for (int radius: { 0, k / 2, k }) {
+                std::vector<HammingMatch> matches = index.within(query, radius);
+                std::size_t next = 0;
+
+                // Same rows as a scan, by increasing distance
+                for (int d = 0; d <= radius; d++) {
+                    for (std::size_t r = 0; r < signatures.size(); r++) {
+                        if (std::popcount(signatures[r] ^ query) == d) {
+                            CHECK(next < matches.size());
+                            UNSIGNED_LONGS_EQUAL(r, matches[next].row);
+                            LONGS_EQUAL(d, matches[next].distance);
+                            next++;
+                        }
+                    }
+                }
+
+                UNSIGNED_LONGS_EQUAL(next, matches.size());
+            }
+        }
+
+        CHECK_THROWS(std::invalid_argument, index.within(0, k + 1));
+    }
+
+    CHECK(SimHashIndex({}, 3).within(42).empty());
+    CHECK_THROWS(std::invalid_argument, SimHashIndex(signatures, 64));
+    CHECK_THROWS(std::invalid_argument, SimHashIndex(signatures, -1));
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
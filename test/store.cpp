@@ -0,0 +1,107 @@
+/**
+ * @file store.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the column-wise store of reference fingerprints
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <finger/store.hpp>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+/**
+ * @brief Difference allowed between the float kernels and distance()
+ */
+static constexpr double TOLERANCE = 1e-5;
+
+/**
+ * @brief Fingerprints of the full dataset
+ */
+static std::vector<std::string> load_fingerprints() {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<std::string> fingerprints;
+
+    for (auto& entry: set) {
+        if (dataset_contains(entry, { "fingerprint" })) {
+            fingerprints.push_back(entry["fingerprint"].get<std::string>());
+        }
+    }
+
+    return fingerprints;
+}
+
+TEST_GROUP(Store) {};
+
+TEST(Store, SameAsDistance) {
+    std::vector<std::string> texts = load_fingerprints();
+
+    // Edge cases of the numeric columns: empty, non numeric and infinite values
+    texts.push_back("1.0|2|0.5|||||GE|1|ho,co,ac|co:ke-al/ac:f159e9d0|||");
+    texts.push_back("|2|abc|||-inf||GE|1|ho,co|co:ke-al|||");
+    texts.push_back("-0.0|x|-inf|||||PO||ac,ho,co|ac:f159e9d0/co:ke-al|0.5|4.2|1.1");
+
+    for (const FeatureTypes& mode: { FULL_FEATURES, FEATURESET[0], FEATURESET[3] }) {
+        std::vector<Fingerprint> fingerprints;
+        FingerprintTable table(mode);
+
+        for (const std::string& text: texts) {
+            fingerprints.emplace_back(text, FULL_FEATURES);
+            table.add(fingerprints.back());
+        }
+
+        UNSIGNED_LONGS_EQUAL(texts.size(), table.size());
+
+        std::vector<double> out(table.size());
+
+        for (const Fingerprint& query: fingerprints) {
+            table.distances(query, out);
+
+            for (std::size_t row = 0; row < table.size(); row++) {
+                DOUBLES_EQUAL(distance(fingerprints[row], query, mode), out[row], TOLERANCE);
+            }
+
+            // Rows far enough from the threshold to not depend on the float precision
+            for (double threshold: { 0., 0.05, 0.2, 0.5 }) {
+                std::vector<TableMatch> matches = table.within(query, threshold);
+                std::size_t m = 0;
+
+                for (std::size_t row = 0; row < table.size(); row++) {
+                    bool found = m < matches.size() && matches[m].row == row;
+                    double d = distance(fingerprints[row], query, mode);
+
+                    if (found) {
+                        DOUBLES_EQUAL(d, matches[m].distance, TOLERANCE);
+                        CHECK(d <= threshold + TOLERANCE);
+                        m++;
+                    } else {
+                        CHECK(d > threshold - TOLERANCE);
+                    }
+                }
+
+                UNSIGNED_LONGS_EQUAL(matches.size(), m);
+            }
+        }
+    }
+}
+
+TEST(Store, MissingFeatures) {
+    FingerprintTable table(FULL_FEATURES);
+    Fingerprint coarse("1|1||0|ho,co", FEATURESET[3]);
+    std::vector<double> out(1);
+
+    CHECK_THROWS(std::invalid_argument, table.add(coarse));
+
+    table.add(Fingerprint("1.0|2|0.5|||||GE|1|ho,co,ac|co:ke-al/ac:f159e9d0|||", FULL_FEATURES));
+    CHECK_THROWS(std::invalid_argument, table.within(coarse, 1));
+    CHECK_THROWS(std::invalid_argument, table.distances(coarse, out));
+
+    // One distance per row
+    Fingerprint full("1.0|2|0.5|||||GE|1|||||", FULL_FEATURES);
+    CHECK_THROWS(std::invalid_argument, table.distances(full, {}));
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
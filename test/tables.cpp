@@ -0,0 +1,137 @@
+/**
+ * @file tables.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the configuration tables loaded at run time
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <atomic>
+#include <finger/cache.hpp>
+#include <finger/fingerprint.hpp>
+#include <finger/tables.hpp>
+#include <fstream>
+#include <test/dataset.hpp>
+#include <thread>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+TEST_GROUP(Tables) {
+    TEST_TEARDOWN() {
+        config_reset();
+        header_cache_disable();
+        value_cache_disable();
+    }
+};
+
+TEST(Tables, LoadAndReset) {
+    std::vector<std::string> headers = { "Host: localhost",
+                                         "Accept: text/x-custom",
+                                         "Accept-Encoding: zstd" };
+    std::string compiled = header_fingerprint(headers);
+
+    header_cache_enable(16);
+    STRCMP_EQUAL(compiled.c_str(), header_fingerprint(headers).c_str());
+
+    const char* path = "/tmp/fingerlib-tables.json";
+    std::ofstream(path) << R"({ "ACCEPT": { "text/x-custom": "te/cu" }, "AE": { "zstd": "zs" },
+                               "EXT": [ "php" ] })";
+    config_load_file(path);
+    std::remove(path);
+
+    // Memoized blocks encoded with the previous tables are dropped
+    std::string loaded = header_fingerprint(headers);
+    CHECK(loaded.find("ac:te/cu") != std::string::npos);
+    CHECK(loaded.find("ac-en:zs") != std::string::npos);
+    CHECK(loaded != compiled);
+
+    // Tables not given keep their compiled values
+    STRCMP_EQUAL(compiled.substr(0, compiled.find('|')).c_str(),
+                 loaded.substr(0, loaded.find('|')).c_str());
+
+    config_reset();
+    STRCMP_EQUAL(compiled.c_str(), header_fingerprint(headers).c_str());
+    UNSIGNED_LONGS_EQUAL(0, config_reclaim());
+
+    header_cache_disable();
+}
+
+TEST(Tables, InvalidTables) {
+    std::string compiled = header_fingerprint({ "Accept: text/x-custom" });
+
+    CHECK_THROWS(std::invalid_argument, config_load({ { "UNKNOWN", { { "a", "b" } } } }));
+    CHECK_THROWS(std::invalid_argument, config_load({ { "EXT", { { "php", "ph" } } } }));
+    CHECK_THROWS(std::invalid_argument, config_load({ { "ACCEPT", { { "text/x-custom", 1 } } } }));
+    CHECK_THROWS(std::invalid_argument, config_load_file("/nonexistent/tables.json"));
+
+    STRCMP_EQUAL(compiled.c_str(), header_fingerprint({ "Accept: text/x-custom" }).c_str());
+}
+
+TEST(Tables, ReloadWhileFingerprinting) {
+    auto set = dataset_use("test/data/dataset_full.json", { "sets", "full" });
+    std::vector<HTTPRequest> requests;
+    std::vector<std::string> expected;
+
+    for (auto& entry: set) {
+        if (!dataset_contains(
+            entry, { "uri", "method", "version", "headers", "payload", "fingerprint" })) {
+            continue;
+        }
+
+        requests.emplace_back(entry["uri"].get<std::string>(),
+                              entry["method"].get<std::string>(),
+                              entry["version"].get<std::string>(),
+                              entry["headers"].get<std::vector<std::string>>(),
+                              entry["payload"].get<std::string>());
+        expected.push_back(entry["fingerprint"].get<std::string>());
+    }
+
+    // Loaded tables equal to the compiled ones: every fingerprint stays the same across reloads
+    nlohmann::json tables;
+
+    for (const FrozenEntry& entry: ACCEPT) {
+        tables["ACCEPT"][std::string(entry.key)] = std::string(entry.value);
+    }
+
+    std::atomic<bool> stop = false;
+    std::atomic<int> mismatches = 0;
+    std::vector<std::thread> threads;
+
+    value_cache_enable(16);
+
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            while (!stop) {
+                for (std::size_t i = 0; i < requests.size(); i++) {
+                    if (fingerprint(requests[i]) != expected[i]) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+
+    for (int reload = 0; reload < 200; reload++) {
+        if (reload % 2 == 0) {
+            config_load(tables);
+        } else {
+            config_reset();
+        }
+    }
+
+    stop = true;
+
+    for (auto& thread: threads) {
+        thread.join();
+    }
+
+    value_cache_disable();
+    config_reset();
+
+    LONGS_EQUAL(0, mismatches);
+    UNSIGNED_LONGS_EQUAL(0, config_reclaim());
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }
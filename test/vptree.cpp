@@ -0,0 +1,186 @@
+/**
+ * @file vptree.cpp
+ * @author Gautier Miquet
+ * @brief Tests of the vantage-point tree
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+#include <algorithm>
+#include <finger/modes.hpp>
+#include <finger/vptree.hpp>
+#include <sstream>
+#include <test/dataset.hpp>
+
+// clang-format off
+#include <CppUTest/CommandLineTestRunner.h>
+#include <CppUTest/TestHarness.h>
+// clang-format on
+
+static constexpr double TOLERANCE = 1e-9;
+
+/**
+ * @brief Keeps the fields of a full fingerprint used by the mode
+ */
+static std::string project(const std::string& fp, const FeatureTypes& mode) {
+    std::string projected;
+    std::size_t start = 0;
+
+    for (std::size_t i = 0; i < FEATURE_COUNT; i++) {
+        std::size_t end = std::min(fp.find('|', start), fp.size());
+
+        if (mode[i] != 0) {
+            projected += (projected.empty() ? "" : "|") + fp.substr(start, end - start);
+        }
+
+        start = end + 1;
+    }
+
+    return projected;
+}
+
+/**
+ * @brief Distances from the query to all the fingerprints, sorted
+ */
+static std::vector<double> bruteForce(const std::vector<std::string>& fingerprints,
+                                      const Fingerprint& query) {
+    std::vector<double> distances;
+
+    for (const std::string& fp: fingerprints) {
+        distances.push_back(distance(query, Fingerprint(fp, FULL_FEATURES)));
+    }
+
+    std::sort(distances.begin(), distances.end());
+
+    return distances;
+}
+
+/**
+ * @brief Checks that the matches are sorted, at their right distance, and as close as the brute
+ * force ones
+ */
+static void checkMatches(const VPTree& tree, const Fingerprint& query,
+                         const std::vector<TableMatch>& matches,
+                         const std::vector<double>& expected) {
+    UNSIGNED_LONGS_EQUAL(expected.size(), matches.size());
+
+    for (std::size_t i = 0; i < matches.size(); i++) {
+        DOUBLES_EQUAL(expected[i], matches[i].distance, TOLERANCE);
+        DOUBLES_EQUAL(distance(query, Fingerprint(tree.text(matches[i].row), FULL_FEATURES)),
+                      matches[i].distance, TOLERANCE);
+    }
+}
+
+TEST_GROUP(VPTree) {};
+
+TEST(VPTree, Knn) {
+    std::vector<std::string> fingerprints = dataset_references(2000, 3, false, 1);
+    VPTree tree(fingerprints, FULL_FEATURES);
+
+    UNSIGNED_LONGS_EQUAL(fingerprints.size(), tree.size());
+
+    for (std::size_t q = 0; q < fingerprints.size(); q += 97) {
+        Fingerprint query(fingerprints[q], FULL_FEATURES);
+        std::vector<double> all = bruteForce(fingerprints, query);
+
+        for (std::size_t k: { 1, 5, 40 }) {
+            std::vector<TableMatch> matches = tree.knn(query, k);
+            checkMatches(tree, query, matches, std::vector<double>(all.begin(), all.begin() + k));
+        }
+
+        // A reference is its own nearest neighbour
+        DOUBLES_EQUAL(0, tree.knn(query, 1)[0].distance, TOLERANCE);
+    }
+
+    Fingerprint query(fingerprints[0], FULL_FEATURES);
+    CHECK(tree.knn(query, 0).empty());
+    UNSIGNED_LONGS_EQUAL(fingerprints.size(), tree.knn(query, 5000).size());
+}
+
+TEST(VPTree, Within) {
+    std::vector<std::string> fingerprints = dataset_references(2000, 3, false, 1);
+    VPTree tree(fingerprints, FULL_FEATURES);
+
+    for (std::size_t q = 0; q < fingerprints.size(); q += 89) {
+        Fingerprint query(fingerprints[q], FULL_FEATURES);
+        std::vector<double> all = bruteForce(fingerprints, query);
+
+        for (double radius: { 0., 0.02, 0.1, 0.3 }) {
+            std::vector<double> expected(all.begin(),
+                                         std::upper_bound(all.begin(), all.end(), radius));
+            checkMatches(tree, query, tree.within(query, radius), expected);
+        }
+    }
+
+    // The query only has to hold the features of the tree
+    std::vector<std::string> coarse_fingerprints;
+
+    for (const std::string& fp: fingerprints) {
+        coarse_fingerprints.push_back(project(fp, FEATURESET[3]));
+    }
+
+    VPTree coarse(coarse_fingerprints, FEATURESET[3]);
+    Fingerprint query(fingerprints[0], FULL_FEATURES);
+    CHECK(!coarse.within(query, 0).empty());
+    CHECK_THROWS(std::invalid_argument, tree.within(Fingerprint("1|1||0|ho,co", FEATURESET[3]), 0));
+    CHECK_THROWS(std::invalid_argument, VPTree({ "1|2" }, FULL_FEATURES));
+}
+
+TEST(VPTree, Threads) {
+    std::vector<std::string> fingerprints = dataset_references(20000, 3, false, 1);
+    VPTree serial(fingerprints, FULL_FEATURES, 1);
+    VPTree parallel(fingerprints, FULL_FEATURES, 8);
+    std::ostringstream a;
+    std::ostringstream b;
+
+    // The tree does not depend on the number of threads
+    serial.save(a);
+    parallel.save(b);
+    CHECK(a.str() == b.str());
+}
+
+TEST(VPTree, Serialization) {
+    std::vector<std::string> fingerprints = dataset_references(500, 3, false, 1);
+    std::vector<std::string> projected;
+
+    for (const std::string& fp: fingerprints) {
+        projected.push_back(project(fp, FEATURESET[2]));
+    }
+
+    VPTree tree(projected, FEATURESET[2]);
+    std::stringstream stream;
+
+    tree.save(stream);
+    VPTree loaded = VPTree::load(stream);
+
+    UNSIGNED_LONGS_EQUAL(tree.size(), loaded.size());
+    CHECK(tree.mode() == loaded.mode());
+
+    for (std::size_t q = 0; q < fingerprints.size(); q += 50) {
+        Fingerprint query(fingerprints[q], FULL_FEATURES);
+        std::vector<TableMatch> expected = tree.knn(query, 10);
+        std::vector<TableMatch> matches = loaded.knn(query, 10);
+
+        UNSIGNED_LONGS_EQUAL(expected.size(), matches.size());
+
+        for (std::size_t i = 0; i < matches.size(); i++) {
+            UNSIGNED_LONGS_EQUAL(expected[i].row, matches[i].row);
+            DOUBLES_EQUAL(expected[i].distance, matches[i].distance, TOLERANCE);
+        }
+    }
+
+    // Truncated or foreign streams
+    std::string saved = stream.str();
+    std::istringstream truncated(saved.substr(0, saved.size() - 1));
+    std::istringstream foreign("not a tree");
+    CHECK_THROWS(std::invalid_argument, VPTree::load(truncated));
+    CHECK_THROWS(std::invalid_argument, VPTree::load(foreign));
+
+    // Empty tree
+    std::stringstream empty;
+    VPTree({}, FULL_FEATURES).save(empty);
+    VPTree none = VPTree::load(empty);
+    UNSIGNED_LONGS_EQUAL(0, none.size());
+    CHECK(none.knn(Fingerprint(fingerprints[0], FULL_FEATURES), 3).empty());
+}
+
+int main(int argc, char** argv) { return CommandLineTestRunner::RunAllTests(argc, argv); }